@@ -0,0 +1,323 @@
+#pragma once
+
+#include <cstdint>
+#include "onedal/table.hpp"
+#include "onedal/train.hpp"
+
+namespace onedal::kmeans {
+
+namespace method {
+   /// Tag-type that denotes `Lloyd's method <lloyd_>`_.
+   struct lloyd {};
+
+   /// Alias tag-type for `Lloyd's method <lloyd_>`_.
+   using by_default = lloyd;
+} // namespace method
+
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::lloyd`.
+template <typename Float = float,
+          typename Method = method::by_default>
+class descriptor {
+public:
+   /// Creates a new instance of the class with the default property values.
+   descriptor();
+
+   /// The number of clusters $k$
+   /// @remark default = 2
+   /// @invariant :expr:`cluster_count > 0`
+   std::int64_t get_cluster_count() const;
+   descriptor& set_cluster_count(std::int64_t);
+
+   /// The maximum number of iterations $T$
+   /// @remark default = 100
+   /// @invariant :expr:`max_iteration_count >= 0`
+   std::int64_t get_max_iteration_count() const;
+   descriptor& set_max_iteration_count(std::int64_t);
+
+   /// The threshold $\varepsilon$ for the stop condition
+   /// @remark default = 0.0
+   /// @invariant :expr:`accuracy_threshold >= 0.0`
+   double get_accuracy_threshold() const;
+   descriptor& set_accuracy_threshold(double);
+};
+
+class model {
+public:
+   /// Creates a new instance of the class with the default property values.
+   model();
+
+   /// $k \times p$ table with the cluster centroids. Each row of the table
+   /// stores one centroid.
+   /// @remark default = table{}
+   const table& get_centroids() const;
+
+   /// The number of clusters $k$ in the trained model
+   /// @remark default = 0
+   /// @invariant :expr:`cluster_count == centroids.observation_count`
+   std::int64_t get_cluster_count() const;
+};
+
+class train_input {
+public:
+   train_input(const table& data = table{},
+               const table& initial_centroids = table{});
+
+   /// $n \times p$ table with the data to be clustered, where each row stores
+   /// one feature vector
+   /// @remark default = table{}
+   const table& get_data() const;
+   train_input& set_data(const table&);
+
+   /// $k \times p$ table with the initial centroids, where each row stores
+   /// one centroid
+   /// @remark default = table{}
+   const table& get_initial_centroids() const;
+   train_input& set_initial_centroids(const table&);
+};
+
+class train_result {
+public:
+   train_result();
+
+   /// The trained K-Means model
+   /// @remark default = model{}
+   const model& get_model() const;
+
+   /// $n \times 1$ table with the labels $y_i$ assigned to the feature
+   /// vectors $x_i$ of the input data
+   /// @remark default = table{}
+   const table& get_labels() const;
+
+   /// The number of iterations performed by the algorithm
+   /// @remark default = 0
+   /// @invariant :expr:`iteration_count >= 0`
+   std::int64_t get_iteration_count() const;
+
+   /// The value of the objective function $\Phi_X(C)$, where $C$ is
+   /// :expr:`model.centroids`
+   /// @remark default = 0.0
+   /// @invariant :expr:`objective_function_value >= 0.0`
+   double get_objective_function_value() const;
+};
+
+/// Runs the training operation for K-Means. For more details see
+/// :expr:`onedal::train`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::lloyd`.
+///
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input Input data for the training operation
+/// @return result Result of the training operation
+///
+/// @pre :expr:`input.data.is_empty == false`
+/// @pre :expr:`input.initial_centroids.is_empty == false`
+/// @pre :expr:`input.initial_centroids.observation_count == desc.cluster_count`
+/// @pre :expr:`input.initial_centroids.feature_count == input.data.feature_count`
+/// @post :expr:`result.labels.is_empty == false`
+/// @post :expr:`result.labels.observation_count == input.data.observation_count`
+/// @post :expr:`result.model.centroids.is_empty == false`
+/// @post :expr:`result.model.cluster_count == desc.cluster_count`
+/// @post :expr:`result.model.centroids.feature_count == input.data.feature_count`
+/// @post :expr:`result.iteration_count <= desc.max_iteration_count`
+template <typename Float, typename Method>
+train_result train(const descriptor<Float, Method>& desc,
+                   const train_input& input);
+
+/// The statistics of one step of `Lloyd's method <lloyd_>`_ accumulated over
+/// the blocks of data processed in the :txtref:`online <Online>` or
+/// :txtref:`distributed <Distributed>` mode. The size of the partial result
+/// is $O(k \cdot p)$ and does not depend on the number of processed feature
+/// vectors.
+class partial_train_result {
+public:
+   /// Creates a new instance of the class that represents no processed data.
+   partial_train_result();
+
+   /// Creates a new instance of the class from the given statistics, for
+   /// example the statistics combined across the nodes of a cluster.
+   partial_train_result(const table& centroids,
+                        const table& partial_sums,
+                        const table& partial_counts,
+                        double partial_objective_function_value);
+
+   /// $k \times p$ table with the centroids $C^{(t)}$ the statistics are
+   /// computed for
+   /// @remark default = table{}
+   const table& get_centroids() const;
+
+   /// $k \times p$ table, where the $j$-th row stores the sum of the processed
+   /// feature vectors assigned to the $j$-th cluster
+   /// @remark default = table{}
+   const table& get_partial_sums() const;
+
+   /// $k \times 1$ table, where the $j$-th row stores the number of the
+   /// processed feature vectors assigned to the $j$-th cluster
+   /// @remark default = table{}
+   const table& get_partial_counts() const;
+
+   /// The sum of the squared distances from the processed feature vectors
+   /// to the nearest centroids
+   /// @remark default = 0.0
+   /// @invariant :expr:`partial_objective_function_value >= 0.0`
+   double get_partial_objective_function_value() const;
+};
+
+class partial_train_input {
+public:
+   partial_train_input(const partial_train_result& prior = partial_train_result{},
+                       const table& centroids = table{},
+                       const table& data = table{});
+
+   /// The partial result produced for the previous blocks. Shall be empty
+   /// for the first block of an iteration.
+   /// @remark default = partial_train_result{}
+   const partial_train_result& get_prior() const;
+   partial_train_input& set_prior(const partial_train_result&);
+
+   /// $k \times p$ table with the centroids $C^{(t)}$ of the current
+   /// iteration
+   /// @remark default = table{}
+   const table& get_centroids() const;
+   partial_train_input& set_centroids(const table&);
+
+   /// The current block of the data to be clustered
+   /// @remark default = table{}
+   const table& get_data() const;
+   partial_train_input& set_data(const table&);
+};
+
+/// Runs the Assignment step of `Lloyd's method <lloyd_>`_ for one block of
+/// data and accumulates the statistics of the block into the partial result.
+/// For more details see :expr:`onedal::partial_train`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::lloyd`.
+///
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input The partial result for the previous blocks, the current
+///                  centroids and the current block
+/// @return result The partial result updated with the current block
+///
+/// @pre :expr:`input.data.is_empty == false`
+/// @pre :expr:`input.centroids.observation_count == desc.cluster_count`
+/// @pre :expr:`input.centroids.feature_count == input.data.feature_count`
+template <typename Float, typename Method>
+partial_train_result partial_train(const descriptor<Float, Method>& desc,
+                                   const partial_train_input& input);
+
+/// Runs the Update step of `Lloyd's method <lloyd_>`_ from the statistics
+/// accumulated over all the blocks of data. A cluster with no assigned
+/// feature vectors keeps its centroid. For more details see
+/// :expr:`onedal::finalize_train`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::lloyd`.
+///
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input The partial result accumulated over all the blocks
+/// @return result The model with the centroids $C^{(t + 1)}$. The labels are
+///                not computed.
+///
+/// @pre :expr:`input.partial_sums.is_empty == false`
+/// @post :expr:`result.labels.is_empty == true`
+/// @post :expr:`result.iteration_count == 1`
+/// @post :expr:`result.objective_function_value == input.partial_objective_function_value`
+template <typename Float, typename Method>
+train_result finalize_train(const descriptor<Float, Method>& desc,
+                            const partial_train_result& input);
+
+class infer_input {
+public:
+   infer_input(const model& m = model{},
+               const table& data = table{});
+
+   /// The trained K-Means model
+   /// @remark default = model{}
+   const model& get_model() const;
+   infer_input& set_model(const model&);
+
+   /// $n \times p$ table with the data to be assigned to the clusters, where
+   /// each row stores one feature vector
+   /// @remark default = table{}
+   const table& get_data() const;
+   infer_input& set_data(const table&);
+};
+
+class infer_result {
+public:
+   infer_result();
+
+   /// $n \times 1$ table with the labels assigned to the feature vectors
+   /// @remark default = table{}
+   const table& get_labels() const;
+
+   /// The value of the objective function $\Phi_X(C)$, where $C$ is
+   /// :expr:`input.model.centroids`
+   /// @remark default = 0.0
+   /// @invariant :expr:`objective_function_value >= 0.0`
+   double get_objective_function_value() const;
+};
+
+/// Runs the inference operation for K-Means. For more details see
+/// :expr:`onedal::infer`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::lloyd`.
+///
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input Input data for the inference operation
+/// @return result Result of the inference operation
+///
+/// @pre :expr:`input.data.is_empty == false`
+/// @pre :expr:`input.model.cluster_count == desc.cluster_count`
+/// @pre :expr:`input.model.centroids.feature_count == input.data.feature_count`
+/// @post :expr:`result.labels.is_empty == false`
+/// @post :expr:`result.labels.observation_count == input.data.observation_count`
+template <typename Float, typename Method>
+infer_result infer(const descriptor<Float, Method>& desc,
+                   const infer_input& input);
+
+} // namespace onedal::kmeans
+
+namespace onedal::kmeans::example {
+
+kmeans::model run_training(const table& data,
+                           const table& initial_centroids) {
+   const auto kmeans_desc = kmeans::descriptor<float>{}
+      .set_cluster_count(10)
+      .set_max_iteration_count(50)
+      .set_accuracy_threshold(1e-4);
+
+   const auto result = kmeans::train(kmeans_desc,
+      kmeans::train_input{data, initial_centroids});
+
+   return result.get_model();
+}
+
+table run_inference(const kmeans::model& model, const table& new_data) {
+   const auto kmeans_desc = kmeans::descriptor<float>{}
+      .set_cluster_count(model.get_cluster_count());
+
+   const auto result = kmeans::infer(kmeans_desc, kmeans::infer_input{model, new_data});
+
+   return result.get_labels();
+}
+
+} // onedal::kmeans::example
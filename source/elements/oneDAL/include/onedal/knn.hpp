@@ -1,4 +1,8 @@
 #include <cstdint>
+#include <vector>
+#ifdef ONEDAL_DATA_PARALLEL
+#include <CL/sycl.hpp>
+#endif
 #include "onedal/table.hpp"
 #include "onedal/train.hpp"
 
@@ -12,6 +16,10 @@ namespace method {
    /// Tag-type that denotes `k-d tree <t_math_kd_tree>`_ computational method.
    struct kd_tree {};
 
+   /// Tag-type that denotes `approximate graph-based <t_math_hnsw_>`_
+   /// computational method.
+   struct hnsw {};
+
    /// Alias tag-type for `brute-force <t_math_brute_force_>`_ computational
    /// method.
    using by_default = bruteforce;
@@ -21,7 +29,8 @@ namespace method {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::bruteforce` or :expr:`method::kd_tree`.
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
 template <typename Float = float,
           typename Method = method::by_default>
 class descriptor {
@@ -40,14 +49,99 @@ public:
    /// @invariant :expr:`neighbor_count > 0`
    std::int64_t get_neighbor_count() const;
    descriptor& set_neighbor_count(std::int64_t);
+
+   /// The maximum number of feature vectors in a bucket of the `k-d tree
+   /// <t_math_kd_tree_>`_. Used only by :expr:`method::kd_tree`.
+   /// @remark default = 16
+   /// @invariant :expr:`max_leaf_size > 0`
+   std::int64_t get_max_leaf_size() const;
+   descriptor& set_max_leaf_size(std::int64_t);
+
+   /// The maximum number of neighbors $M$ of a vertex in a layer of the
+   /// `graph <t_math_hnsw_>`_. Used only by :expr:`method::hnsw`.
+   /// @remark default = 16
+   /// @invariant :expr:`max_degree > 1`
+   std::int64_t get_max_degree() const;
+   descriptor& set_max_degree(std::int64_t);
+
+   /// The number of candidates $e_c$ kept while the neighbors of a new vertex
+   /// are searched at the training stage. Larger values improve the quality
+   /// of the graph at the cost of longer training. Used only by
+   /// :expr:`method::hnsw`.
+   /// @remark default = 100
+   /// @invariant :expr:`build_effort >= max_degree`
+   std::int64_t get_build_effort() const;
+   descriptor& set_build_effort(std::int64_t);
+
+   /// The number of candidates $e_s$ kept during the search at the inference
+   /// stage. This is the recall/speed knob: larger values increase the recall
+   /// and the latency of the inference. Used only by :expr:`method::hnsw`.
+   /// @remark default = 64
+   /// @invariant :expr:`search_effort >= neighbor_count`
+   std::int64_t get_search_effort() const;
+   descriptor& set_search_effort(std::int64_t);
 };
 
+/// The trained $k$-NN model. For :expr:`method::bruteforce`, the model stores
+/// the training set $X$ and the labels $y$. For :expr:`method::kd_tree`, the
+/// model also stores the :txtref:`k-d tree <kd_tree>` built at the training
+/// stage, and for :expr:`method::hnsw`, the graph built at the training stage.
+/// The layout of the model is implementation-defined.
 class model {
 public:
    /// Creates a new instance of the class with the default property values.
    model();
+
+   /// The number of bytes required to store the model in the `serialized
+   /// form <knn_serialization_>`_
+   /// @remark default = 0
+   /// @invariant :expr:`serialized_size >= 0`
+   std::int64_t get_serialized_size() const;
+
+   /// Writes the model in the `serialized form <knn_serialization_>`_ to the
+   /// memory block. The block can be stored in a file and later mapped into
+   /// memory to create the model with :expr:`onedal::knn::deserialize`.
+   ///
+   /// @param[out] data The memory block aligned to 64 bytes
+   /// @param[in]  size The size of the memory block in bytes
+   ///
+   /// @pre :expr:`data != nullptr`
+   /// @pre :expr:`size >= serialized_size`
+   void serialize(void* data, std::int64_t size) const;
 };
 
+/// Creates the $k$-NN model from the `serialized form <knn_serialization_>`_.
+/// The model references the memory block directly: the data, the labels and
+/// the structures built at the training stage are neither copied nor
+/// converted, so the block mapped from a file with :expr:`mmap` is usable
+/// for inference immediately. The memory block shall stay valid and
+/// unchanged until the last reference to the model is destroyed.
+///
+/// The function validates the header of the serialized form. If the
+/// serialization format version, the floating-point type, the method or the
+/// byte order stored in the header differ from the ones of the
+/// implementation, :expr:`onedal::invalid_argument` is thrown.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Shall be the same as at the
+///                training stage.
+/// @tparam Method Tag-type that specifies an implementation of algorithm.
+///                Shall be the same as at the training stage.
+///
+/// @param[in] desc Descriptor of the algorithm
+/// @param[in] data The memory block aligned to 64 bytes
+/// @param[in] size The size of the memory block in bytes
+/// @return model The model that references the memory block
+///
+/// @pre :expr:`data != nullptr`
+/// @pre :expr:`size` is not less than the size of the serialized form
+/// @pre The memory block contains the model written by
+///      :expr:`onedal::knn::model::serialize`
+template <typename Float, typename Method>
+model deserialize(const descriptor<Float, Method>& desc,
+                  const void* data,
+                  std::int64_t size);
+
 class train_input {
 public:
    train_input(const table& data = table{},
@@ -80,7 +174,8 @@ public:
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::bruteforce` or :expr:`method::kd_tree`.
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
 ///
 /// @param[in] desc  Descriptor of the algorithm
 /// @param[in] input Input data for the training operation
@@ -89,13 +184,127 @@ public:
 /// @pre :expr:`input.data.has_data == true`
 /// @pre :expr:`input.labels.has_data == true`
 /// @pre :expr:`input.data.rows == input.labels.rows`
-/// @pre :expr:`input.data.columns == 1`
+/// @pre :expr:`input.labels.columns == 1`
 /// @pre :expr:`input.labels[i] >= 0`
 /// @pre :expr:`input.labels[i] < desc.class_count`
 template <typename Float, typename Method>
 train_result train(const descriptor<Float, Method>& desc,
                    const train_input& input);
 
+/// The state of the $k$-NN training accumulated over the blocks of the
+/// training set processed in the :txtref:`online <Online>` mode. For
+/// :expr:`method::bruteforce`, the partial result references the processed
+/// blocks, so no training data is copied. For :expr:`method::kd_tree`, the
+/// partial result may also contain the subtrees built for the processed
+/// blocks. The layout of the partial result is implementation-defined.
+class partial_train_result {
+public:
+   /// Creates a new instance of the class that represents no processed data.
+   partial_train_result();
+
+   /// The number of feature vectors in the processed blocks
+   /// @remark default = 0
+   /// @invariant :expr:`observation_count >= 0`
+   std::int64_t get_observation_count() const;
+};
+
+class partial_train_input {
+public:
+   partial_train_input(const partial_train_result& prior = partial_train_result{},
+                       const table& data = table{},
+                       const table& labels = table{});
+
+   /// The partial result produced for the previous blocks
+   /// @remark default = partial_train_result{}
+   const partial_train_result& get_prior() const;
+   partial_train_input& set_prior(const partial_train_result&);
+
+   /// The current block of the training set $X$
+   /// @remark default = table{}
+   const table& get_data() const;
+   partial_train_input& set_data(const table&);
+
+   /// Vector of labels $y$ for the current block
+   /// @remark default = table{}
+   const table& get_labels() const;
+   partial_train_input& set_labels(const table&);
+};
+
+/// Runs the training operation for $k$-NN classifier on one block of the
+/// training set in the :txtref:`online <Online>` mode. For more details see
+/// :expr:`onedal::partial_train`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
+///
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input The partial result for the previous blocks and the
+///                  current block
+/// @return result The partial result updated with the current block
+///
+/// @pre :expr:`input.data.is_empty == false`
+/// @pre :expr:`input.labels.is_empty == false`
+/// @pre :expr:`input.data.observation_count == input.labels.observation_count`
+/// @pre :expr:`input.labels.feature_count == 1`
+/// @pre :expr:`input.data.feature_count` is the same for all blocks
+/// @post :expr:`result.observation_count == input.prior.observation_count + input.data.observation_count`
+template <typename Float, typename Method>
+partial_train_result partial_train(const descriptor<Float, Method>& desc,
+                                   const partial_train_input& input);
+
+/// Computes the trained $k$-NN model from the partial result produced for
+/// all the blocks of the training set. The model is equivalent to the model
+/// trained on the concatenation of the blocks in the order of processing.
+/// For more details see :expr:`onedal::finalize_train`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
+///
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input The partial result produced for the last block
+/// @return result Result of the training operation
+///
+/// @pre :expr:`input.observation_count > 0`
+template <typename Float, typename Method>
+train_result finalize_train(const descriptor<Float, Method>& desc,
+                            const partial_train_result& input);
+
+#ifdef ONEDAL_DATA_PARALLEL
+/// Runs the training operation for $k$-NN classifier on the device associated
+/// with the queue. For more details see :expr:`onedal::train`.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
+///
+/// @param[in] queue The DPC++ queue the operation is submitted to
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input Input data for the training operation
+/// @return result Result of the training operation
+///
+/// @pre :expr:`input.data.has_data == true`
+/// @pre :expr:`input.labels.has_data == true`
+/// @pre :expr:`input.data.rows == input.labels.rows`
+/// @pre :expr:`input.labels.columns == 1`
+/// @pre :expr:`input.labels[i] >= 0`
+/// @pre :expr:`input.labels[i] < desc.class_count`
+template <typename Float, typename Method>
+train_result train(sycl::queue& queue,
+                   const descriptor<Float, Method>& desc,
+                   const train_input& input);
+#endif
+
 
 class infer_input {
 public:
@@ -129,8 +338,8 @@ public:
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::bruteforce` or
-///                :expr:`method::kd_tree`.
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
 ///
 /// @param[in] desc  Descriptor of the algorithm
 /// @param[in] input Input data for the inference operation
@@ -145,11 +354,98 @@ template <typename Float, typename Method>
 infer_result infer(const descriptor<Float, Method>& desc,
                    const infer_input& input);
 
+#ifdef ONEDAL_DATA_PARALLEL
+/// Runs the inference operation for $k$-NN classifier on the device
+/// associated with the queue. For more details see :expr:`onedal::infer`.
+///
+/// With :expr:`method::bruteforce`, the distances between the inference set
+/// $X'$ and the training set $X$ are computed in blocks, and only the $k$
+/// nearest candidates of each feature vector from $X'$ are kept between the
+/// blocks. The $m \times n$ matrix of distances is not stored in the device
+/// memory.
+///
+/// @tparam Float  The floating-point type that the algorithm uses for
+///                intermediate computations. Can be :expr:`float` or
+///                :expr:`double`.
+/// @tparam Method Tag-type that specifies an implementation of algorithm. Can
+///                be :expr:`method::bruteforce`, :expr:`method::kd_tree` or
+///                :expr:`method::hnsw`.
+///
+/// @param[in] queue The DPC++ queue the operation is submitted to
+/// @param[in] desc  Descriptor of the algorithm
+/// @param[in] input Input data for the inference operation
+/// @return result Result of the inference operation
+///
+/// @pre  :expr:`input.data.has_data == true`
+/// @post :expr:`result.labels.rows == input.data.rows`
+/// @post :expr:`result.labels.columns == 1`
+/// @post :expr:`result.labels[i] >= 0`
+/// @post :expr:`result.labels[i] < desc.class_count`
+template <typename Float, typename Method>
+infer_result infer(sycl::queue& queue,
+                   const descriptor<Float, Method>& desc,
+                   const infer_input& input);
+#endif
+
 } // namespace onedal::knn
 
 namespace onedal::knn::example {
 
 knn::model run_training(const table& data, const table& labels) {
+   const auto knn_desc = knn::descriptor<float, knn::method::kd_tree>{5, 10}
+      .set_max_leaf_size(32);
+
+   const auto result = knn::train(knn_desc, knn::train_input{data, labels});
+
+   return result.get_model();
+}
+
+table run_inference(const knn::model& model, const table& new_data) {
+   const auto knn_desc = knn::descriptor<float, knn::method::kd_tree>{5, 10};
+
+   const auto result = knn::infer(knn_desc, knn::infer_input{model, new_data});
+
+   return result.get_labels();
+}
+
+knn::model run_online_training(const std::vector<table>& data_blocks,
+                               const std::vector<table>& label_blocks) {
+   const auto knn_desc = knn::descriptor<float, knn::method::kd_tree>{5, 10};
+
+   knn::partial_train_result partial_result;
+   for (std::size_t i = 0; i < data_blocks.size(); i++) {
+      partial_result = knn::partial_train(knn_desc,
+         knn::partial_train_input{partial_result, data_blocks[i], label_blocks[i]});
+   }
+
+   const auto result = knn::finalize_train(knn_desc, partial_result);
+
+   return result.get_model();
+}
+
+table run_approximate_inference(const table& data,
+                                const table& labels,
+                                const table& new_data) {
+   const auto knn_desc = knn::descriptor<float, knn::method::hnsw>{5, 10}
+      .set_max_degree(32)
+      .set_search_effort(128);
+
+   const auto model = knn::train(knn_desc, knn::train_input{data, labels}).get_model();
+   const auto result = knn::infer(knn_desc, knn::infer_input{model, new_data});
+
+   return result.get_labels();
+}
+
+#ifdef ONEDAL_DATA_PARALLEL
+table run_inference_on_device(sycl::queue& queue,
+                              const knn::model& model,
+                              const table& new_data) {
+   const auto knn_desc = knn::descriptor<float, knn::method::bruteforce>{5, 10};
+
+   const auto result = knn::infer(queue, knn_desc, knn::infer_input{model, new_data});
+
+   return result.get_labels();
 }
+#endif
 
 } // onedal::knn::example
@@ -1,5 +1,173 @@
+#pragma once
+
+#include <cstdint>
+#ifdef ONEDAL_DATA_PARALLEL
+#include <CL/sycl.hpp>
+#include <vector>
+#endif
+
 namespace onedal {
 
-class table {};
+/// The order in which the values of a dense table are stored in memory
+enum class data_layout : std::int64_t {
+   /// The values of each row are stored contiguously, rows follow one after
+   /// another
+   row_major,
+   /// The values of each column are stored contiguously, columns follow one
+   /// after another
+   column_major
+};
+
+/// Runtime information about the data type of a feature
+enum class data_type : std::int64_t {
+   u32, u64,
+   i32, i64,
+   f32, f64
+};
+
+/// Metadata that describe how the data are stored inside a table
+class table_meta {
+public:
+   /// Creates the metadata of an empty table
+   table_meta();
+
+   /// The number of features $p$ in the table
+   /// @remark default = 0
+   /// @invariant :expr:`feature_count >= 0`
+   std::int64_t get_feature_count() const noexcept;
+
+   /// The order in which the values are stored in memory
+   /// @remark default = data_layout::row_major
+   data_layout get_layout() const noexcept;
+};
+
+class table {
+public:
+   /// Creates an empty table with no data and :expr:`table_meta`
+   /// constructed by default
+   table();
+
+   /// The number of features $p$ in the table
+   /// @remark default = 0
+   /// @invariant :expr:`feature_count >= 0`
+   std::int64_t get_feature_count() const noexcept;
+
+   /// The number of observations $N$ in the table
+   /// @remark default = 0
+   /// @invariant :expr:`observation_count >= 0`
+   std::int64_t get_observation_count() const noexcept;
+
+   /// If :expr:`feature_count` or :expr:`observation_count` are zero, the
+   /// table is empty
+   /// @remark default = true
+   bool is_empty() const noexcept;
+
+   /// The object that represents data structure inside the table. For a
+   /// homogeneous table, :expr:`metadata.layout` is the layout passed to the
+   /// constructor.
+   const table_meta& get_metadata() const noexcept;
+};
+
+/// Dense table that contains homogeneous data stored as one contiguous block
+/// of memory in row-major or column-major order. A table created from
+/// user-provided memory references that memory directly: no copy is
+/// performed, and the memory shall stay valid and unchanged until the last
+/// reference to the table is destroyed.
+class homogen_table : public table {
+public:
+   /// Creates an empty table with no data
+   homogen_table();
+
+   /// Creates a table of shape $N \times p$ that wraps the data in host
+   /// memory. The table does not own the data.
+   ///
+   /// @tparam T The type of the data. Can be :expr:`std::uint32_t`,
+   ///           :expr:`std::uint64_t`, :expr:`std::int32_t`,
+   ///           :expr:`std::int64_t`, :expr:`float` or :expr:`double`.
+   ///
+   /// @param[in] data_pointer      The pointer to the data
+   /// @param[in] observation_count The number of rows $N$
+   /// @param[in] feature_count     The number of columns $p$
+   /// @param[in] layout            The order of the values in memory
+   ///
+   /// @pre :expr:`data_pointer != nullptr`
+   /// @pre :expr:`observation_count > 0`
+   /// @pre :expr:`feature_count > 0`
+   template <typename T>
+   homogen_table(const T* data_pointer,
+                 std::int64_t observation_count,
+                 std::int64_t feature_count,
+                 data_layout layout = data_layout::row_major);
+
+   /// Creates a table of shape $N \times p$ that takes the ownership of the
+   /// data in host memory. The deleter is called with :expr:`data_pointer`
+   /// when the last reference to the table is destroyed.
+   ///
+   /// @tparam T       The type of the data
+   /// @tparam Deleter The type of a callable object that accepts
+   ///                 :expr:`T*`
+   ///
+   /// @param[in] data_pointer      The pointer to the data
+   /// @param[in] observation_count The number of rows $N$
+   /// @param[in] feature_count     The number of columns $p$
+   /// @param[in] layout            The order of the values in memory
+   /// @param[in] data_deleter      The object that releases the data
+   template <typename T, typename Deleter>
+   homogen_table(T* data_pointer,
+                 std::int64_t observation_count,
+                 std::int64_t feature_count,
+                 data_layout layout,
+                 Deleter&& data_deleter);
+
+#ifdef ONEDAL_DATA_PARALLEL
+   /// Creates a table of shape $N \times p$ that wraps the data in USM
+   /// memory allocated for the context of the queue. The table does not own
+   /// the data. The data are not accessed before the dependencies are
+   /// complete.
+   ///
+   /// @tparam T The type of the data
+   ///
+   /// @param[in] queue             The queue the USM memory is associated with
+   /// @param[in] data_pointer      The USM pointer to the data
+   /// @param[in] observation_count The number of rows $N$
+   /// @param[in] feature_count     The number of columns $p$
+   /// @param[in] layout            The order of the values in memory
+   /// @param[in] dependencies      The events that produce the data
+   template <typename T>
+   homogen_table(sycl::queue& queue,
+                 const T* data_pointer,
+                 std::int64_t observation_count,
+                 std::int64_t feature_count,
+                 data_layout layout = data_layout::row_major,
+                 const std::vector<sycl::event>& dependencies = {});
+
+   /// Creates a table of shape $N \times p$ that references the data of the
+   /// buffer. The table holds a copy of the buffer object, so the data are
+   /// shared with the buffer and are not copied.
+   ///
+   /// @tparam T The type of the data
+   ///
+   /// @param[in] data              The buffer with :expr:`observation_count *
+   ///                              feature_count` elements
+   /// @param[in] observation_count The number of rows $N$
+   /// @param[in] feature_count     The number of columns $p$
+   /// @param[in] layout            The order of the values in memory
+   template <typename T>
+   homogen_table(const sycl::buffer<T, 1>& data,
+                 std::int64_t observation_count,
+                 std::int64_t feature_count,
+                 data_layout layout = data_layout::row_major);
+#endif
+
+   /// The type of the underlying data
+   data_type get_data_type() const noexcept;
+
+   /// The pointer to the underlying data. The pointer refers to the memory
+   /// passed to the constructor.
+   /// @tparam T The type of the data
+   /// @pre :expr:`data_type` matches :expr:`T`
+   template <typename T>
+   const T* get_data_pointer() const noexcept;
+};
 
 } // namespace onedal
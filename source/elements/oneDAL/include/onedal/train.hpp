@@ -3,4 +3,19 @@ namespace onedal {
 template <typename... Args>
 auto train(Args&& ...args);
 
+/// Runs the training operation in the :txtref:`online <Online>` mode for one
+/// block of data. The arguments are the descriptor of the algorithm followed
+/// by the partial training input or its components: the partial result
+/// produced for the previous blocks and the current block of data. Returns
+/// the updated partial result.
+template <typename... Args>
+auto partial_train(Args&& ...args);
+
+/// Computes the final training result from the partial result produced by
+/// :expr:`onedal::partial_train` for the last block of data. The result is
+/// equivalent to the result of :expr:`onedal::train` applied to all the
+/// blocks of data.
+template <typename... Args>
+auto finalize_train(Args&& ...args);
+
 } // namespace onedal
@@ -25,6 +25,8 @@
 #include <cstdlib>
 #include <iterator>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 
@@ -51,6 +53,7 @@ struct error : public std::exception {};
 struct stream;
 struct memory;
 struct primitive_desc_base;
+struct exec_args;
 
 /// @addtogroup dnnl_api_primitives Primitives
 /// Compute primitives
@@ -102,6 +105,8 @@ struct primitive {
         matmul,
         /// A resampling primitive.
         resampling,
+        /// A primitive that executes a fused partition of a graph.
+        partition,
     };
 
     /// Default constructor. Constructs an empty object.
@@ -112,11 +117,38 @@ struct primitive {
     /// @param pd Primitive descriptor.
     primitive(const primitive_desc_base &pd);
 
+    /// Constructs a primitive from a primitive descriptor and a cache blob.
+    ///
+    /// The cache blob must have been produced by #get_cache_blob() for a
+    /// primitive created from a primitive descriptor with the same cache blob
+    /// ID as @p pd (see #dnnl::primitive_desc_base::get_cache_blob_id()).
+    /// Constructing a primitive this way skips the implementation-specific
+    /// compilation steps, such as just-in-time code generation or GPU kernel
+    /// compilation, that the blob contains the results of.
+    ///
+    /// @param pd Primitive descriptor.
+    /// @param cache_blob Cache blob.
+    primitive(const primitive_desc_base &pd,
+            const std::vector<uint8_t> &cache_blob);
+
     /// Returns the kind of the primitive.
     ///
     /// @returns The primitive kind.
     inline kind get_kind() const;
 
+    /// Returns a cache blob for the primitive.
+    ///
+    /// The cache blob is an opaque sequence of bytes that contains the
+    /// implementation-specific data, such as compiled GPU kernels, required
+    /// to re-create the primitive without recompiling it. The blob is
+    /// meaningful only in conjunction with a primitive descriptor that has
+    /// the same cache blob ID as the descriptor the primitive was created
+    /// from, and only for the same version of the library.
+    ///
+    /// @returns The cache blob. The blob is empty if the implementation does
+    ///     not support cache blobs.
+    std::vector<uint8_t> get_cache_blob() const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index, memory
@@ -150,6 +182,30 @@ struct primitive {
             const std::unordered_map<int, memory> &args,
             const std::vector<cl::sycl::event> &deps = {}) const;
 
+    /// Executes computations specified by the primitive in a specified stream.
+    ///
+    /// Arguments are passed via a pre-built set of execution arguments.
+    /// Unlike the arguments map, the set is validated once when it is
+    /// populated, so the execution does not perform any memory allocation.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Execution arguments.
+    void execute(const stream &astream, const exec_args &args) const;
+
+    /// Executes computations specified by the primitive in a specified stream.
+    ///
+    /// Arguments are passed via a pre-built set of execution arguments.
+    /// Unlike the arguments map, the set is validated once when it is
+    /// populated, so the execution does not perform any memory allocation.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Execution arguments.
+    /// @param deps Optional vector with `cl::sycl::event` dependencies.
+    cl::sycl::event execute_sycl(const stream &astream, const exec_args &args,
+            const std::vector<cl::sycl::event> &deps = {}) const;
+
     /// Assignment operator.
     primitive &operator=(const primitive &rhs);
 };
@@ -172,9 +228,10 @@ enum class scratchpad_mode {
     /// that fall outside of the scope of this specification.
     library,
     /// The user manages the scratchpad allocation by querying and providing
-    /// the scratchpad memory to primitives. This mode is thread-safe as long
-    /// as the scratchpad buffers are not used concurrently by two primitive
-    /// executions.
+    /// the scratchpad memory to primitives, either directly or via a
+    /// #dnnl::scratchpad_pool attached to the stream. This mode is
+    /// thread-safe as long as the scratchpad buffers are not used
+    /// concurrently by two primitive executions.
     user,
 };
 
@@ -540,6 +597,59 @@ struct engine {
 ///
 /// @{
 
+/// A pool of scratchpad memory shared by primitives.
+///
+/// A scratchpad pool owns memory allocated on an engine and provides
+/// scratchpads to primitives created with the #dnnl::scratchpad_mode::user
+/// scratchpad mode and executed on streams that the pool is attached to.
+/// Since scratchpads are only used during the execution of a primitive, the
+/// same memory is reused by primitives executed one after another on the same
+/// stream. The amount of memory held by the pool is therefore determined by
+/// the largest scratchpad rather than by the sum of all scratchpads.
+struct scratchpad_pool {
+    /// Constructs an empty scratchpad pool. An empty pool cannot be used in
+    /// any operations.
+    scratchpad_pool();
+
+    /// Constructs a scratchpad pool.
+    ///
+    /// @param aengine Engine to allocate the scratchpad memory on.
+    /// @param capacity Maximum amount of memory in bytes the pool can hold.
+    ///     A value of 0 means the amount of memory is not limited.
+    scratchpad_pool(const engine &aengine, size_t capacity = 0);
+
+    /// Returns the engine of the scratchpad pool.
+    /// @returns The engine of the scratchpad pool.
+    engine get_engine() const;
+
+    /// Reserves memory for the scratchpad of a primitive.
+    ///
+    /// After this call, executing a primitive created from @p pd does not
+    /// require the pool to allocate memory, unless the memory is used by
+    /// executions that are in progress on other streams.
+    ///
+    /// @param pd Primitive descriptor of the primitive. The primitive
+    ///     descriptor must be created on the engine of the pool.
+    void reserve(const primitive_desc_base &pd);
+
+    /// Returns the amount of memory currently held by the pool.
+    /// @returns The amount of memory in bytes.
+    size_t get_size() const;
+
+    /// Returns the peak amount of scratchpad memory simultaneously used by
+    /// primitive executions since the pool creation or the last call to
+    /// #reset_peak_usage().
+    /// @returns The amount of memory in bytes.
+    size_t get_peak_usage() const;
+
+    /// Resets the peak usage counter to the amount of memory currently used.
+    void reset_peak_usage();
+
+    /// Releases the memory held by the pool that is not used by primitive
+    /// executions in progress.
+    void release_unused();
+};
+
 /// A container for stream attributes.
 struct stream_attr {
     /// Constructs default (empty) stream attributes.
@@ -550,6 +660,35 @@ struct stream_attr {
     ///
     /// @param akind Target engine kind.
     stream_attr(engine::kind akind);
+
+    /// Sets the scratchpad pool for the stream.
+    ///
+    /// A primitive created with the #dnnl::scratchpad_mode::user scratchpad
+    /// mode and executed on the stream without the #DNNL_ARG_SCRATCHPAD
+    /// argument takes its scratchpad from the pool. A primitive executed with
+    /// the #DNNL_ARG_SCRATCHPAD argument uses the memory passed by the user.
+    ///
+    /// @param pool Scratchpad pool. The pool must be created on the engine
+    ///     of the stream. The same pool can be attached to multiple streams.
+    void set_scratchpad_pool(const scratchpad_pool &pool);
+
+    /// Returns the scratchpad pool for the stream.
+    /// @returns The scratchpad pool. The pool is empty if it has not been
+    ///     set.
+    scratchpad_pool get_scratchpad_pool() const;
+
+    /// Enables or disables profiling for the stream.
+    ///
+    /// When profiling is enabled, the stream records a
+    /// #dnnl::profiling_record for every primitive execution. Profiling may
+    /// add overhead to the execution and is disabled by default.
+    ///
+    /// @param enable Profiling mode.
+    void set_profiling(bool enable);
+
+    /// Returns whether profiling is enabled for the stream.
+    /// @returns The profiling mode.
+    bool get_profiling() const;
 };
 
 /// An execution stream.
@@ -915,6 +1054,12 @@ struct memory {
         ///     both on the primitive that would operate on this memory and
         ///     the operation context.
         ///
+        /// @note
+        ///     Dimensions that are not known at the primitive creation time
+        ///     may be set to #DNNL_RUNTIME_DIM_VAL for primitives that
+        ///     support run-time specified shapes. The actual values are
+        ///     taken from the memory objects passed at the execution time.
+        ///
         /// @param adims Tensor dimensions.
         /// @param adata_type Data precision/type.
         /// @param aformat_tag Memory format tag.
@@ -933,6 +1078,13 @@ struct memory {
         ///     both on the primitive that would operate on this memory and
         ///     the operation context.
         ///
+        /// @note
+        ///     Dimensions and strides that are not known at the primitive
+        ///     creation time may be set to #DNNL_RUNTIME_DIM_VAL for
+        ///     primitives that support run-time specified shapes and memory
+        ///     formats. The actual values are taken from the memory objects
+        ///     passed at the execution time.
+        ///
         /// @param adims Tensor dimensions.
         /// @param adata_type Data precision/type.
         /// @param strides Strides for each dimension.
@@ -1249,6 +1401,103 @@ struct post_ops {
     /// @param beta Output beta parameter for the elementwise algorithm.
     void get_params_eltwise(int index, float &scale, algorithm &aalgorithm,
             float &alpha, float &beta) const;
+
+    /// Appends a binary post-op.
+    ///
+    /// The kind of this post-op is #dnnl::primitive::kind::binary.
+    ///
+    /// In the simplest case when the binary is the only post-op, the
+    /// computations would be `dst[:] := binary_op (op(...), src1[:])`
+    /// instead of `dst[:] := op(...)`, where binary_op is configured with the
+    /// given parameters.
+    ///
+    /// The second source tensor supports broadcast semantics: any of its
+    /// dimensions can be 1 and the same value would be used across the
+    /// corresponding dimension of the destination. For example, a
+    /// per-channel bias is described by a `{1, C, 1, 1}` memory descriptor.
+    ///
+    /// The second source tensor is passed at the execution time as an
+    /// argument with index
+    /// `DNNL_ARG_ATTR_MULTIPLE_POST_OP(index) | DNNL_ARG_SRC_1`, where
+    /// `index` is the index of the post-op.
+    ///
+    /// @param aalgorithm Binary algorithm for the post-op.
+    /// @param src1_desc Memory descriptor of the second source tensor. The
+    ///     number of dimensions must be equal to the number of dimensions of
+    ///     the destination tensor.
+    void append_binary(algorithm aalgorithm, const memory::desc &src1_desc);
+
+    /// Returns the parameters of a binary post-op.
+    ///
+    /// @param index Index of the binary post-op.
+    /// @param aalgorithm Output binary algorithm kind.
+    /// @param src1_desc Output memory descriptor of the second source tensor.
+    void get_params_binary(int index, algorithm &aalgorithm,
+            memory::desc &src1_desc) const;
+
+    /// Appends a depthwise post-op convolution.
+    ///
+    /// This post-op can only be fused with a 2D 1x1 convolution (convolution
+    /// with weights spatial dimensions equal to 1 i.e., kh=kw=1).
+    ///
+    /// The kind of this post-op is #dnnl::primitive::kind::convolution.
+    ///
+    /// The number of outputs for the primitive with a depthwise post-op is
+    /// the same as for the 1x1 convolution: the destination memory descriptor
+    /// of the fused primitive describes the output of the depthwise
+    /// convolution. The weights and bias of the depthwise convolution are
+    /// passed at the execution time as arguments with indices
+    /// `DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS` and
+    /// `DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS`. The memory descriptor of
+    /// the weights can be queried using
+    /// #dnnl::primitive_desc_base::query_md(#query::exec_arg_md,
+    /// DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS).
+    ///
+    /// @param weights_data_type Weights data type of the depthwise
+    ///     convolution.
+    /// @param bias_data_type Bias data type of the depthwise convolution. Use
+    ///     #dnnl::memory::data_type::undef if the depthwise convolution has
+    ///     no bias.
+    /// @param dst_data_type Output data type of the depthwise convolution.
+    /// @param kernel_size Size of the kernel of the depthwise convolution.
+    /// @param stride_size Size of the stride of the depthwise convolution.
+    /// @param padding_l_size Size of the left and top paddings of the
+    ///     depthwise convolution.
+    /// @param mask Output scaling factors correspondence mask that defines
+    ///     the correspondence between the output tensor dimensions and the
+    ///     @p scales vector. The set i-th bit indicates that a dedicated
+    ///     output scaling factor is used for each index along that
+    ///     dimension. The mask value of 0 implies a common scaling factor for
+    ///     the whole output tensor.
+    /// @param scales Output scaling factors of the depthwise convolution.
+    void append_dw(memory::data_type weights_data_type,
+            memory::data_type bias_data_type, memory::data_type dst_data_type,
+            memory::dim kernel_size, memory::dim stride_size,
+            memory::dim padding_l_size, int mask,
+            const std::vector<float> &scales);
+
+    /// Returns the parameters of a depthwise post-op convolution.
+    ///
+    /// @param index Index of the depthwise post-op.
+    /// @param weights_data_type Output weights data type of the depthwise
+    ///     convolution.
+    /// @param bias_data_type Output bias data type of the depthwise
+    ///     convolution.
+    /// @param dst_data_type Output destination data type of the depthwise
+    ///     convolution.
+    /// @param kernel_size Output size of the kernel of the depthwise
+    ///     convolution.
+    /// @param stride_size Output size of the stride of the depthwise
+    ///     convolution.
+    /// @param padding_l_size Output size of the left and top paddings of the
+    ///     depthwise convolution.
+    /// @param mask Output scaling factors correspondence mask.
+    /// @param scales Output scaling factors of the depthwise convolution.
+    void get_params_dw(int index, memory::data_type &weights_data_type,
+            memory::data_type &bias_data_type, memory::data_type &dst_data_type,
+            memory::dim &kernel_size, memory::dim &stride_size,
+            memory::dim &padding_l_size, int &mask,
+            std::vector<float> &scales) const;
 };
 
 /// Primitive attributes.
@@ -1404,7 +1653,8 @@ struct primitive_attr {
     /// primitives expect input activations to have the unsigned 8-bit integer
     /// data type. The scale and shift parameters are used to quantize
     /// floating-point data to unsigned integer and must be passed to the RNN
-    /// primitive using attributes.
+    /// primitive using attributes. The low-precision configuration is
+    /// supported by the LSTM, GRU, and LBR GRU primitives.
     ///
     /// The quantization formula is `scale * (data + shift)`.
     ///
@@ -1448,6 +1698,10 @@ struct primitive_attr {
     ///     Quantization scales are common for weights_layer and
     ///     weights_iteration
     ///
+    /// @note
+    ///     To use dedicated scaling factors for each gate and each output
+    ///     channel, set the mask to `(1 << 3) | (1 << 4)`.
+    ///
     /// @param mask Scaling factors correspondence mask that defines the
     ///     correspondence between the output tensor dimensions and the @p
     ///     scales vector. The set i-th bit indicates that a dedicated scaling
@@ -1604,10 +1858,190 @@ struct primitive_desc_base {
     /// Returns the kind of the primitive descriptor.
     /// @returns The kind of the primitive descriptor.
     dnnl::primitive::kind get_kind() const;
+
+    /// Returns the cache blob ID of the primitive descriptor.
+    ///
+    /// The cache blob ID uniquely identifies the operation descriptor, the
+    /// primitive attributes, the implementation, and the engine (including
+    /// the device and the driver versions) the primitive descriptor was
+    /// created with. It is intended to be used as a key to store and look up
+    /// cache blobs in a persistent storage managed by the user.
+    ///
+    /// @returns The cache blob ID. The ID is empty if the implementation does
+    ///     not support cache blobs.
+    std::vector<uint8_t> get_cache_blob_id() const;
+};
+
+/// A reusable set of execution arguments.
+///
+/// The set stores <index, memory object> pairs in a flat storage that is
+/// allocated once. When constructed for a particular primitive descriptor,
+/// the set is sized for the arguments of the primitive and the memory
+/// objects are validated against the primitive descriptor when they are set,
+/// so the execution with the set does not need to validate them again.
+struct exec_args {
+    /// Constructs an empty set of execution arguments.
+    exec_args();
+
+    /// Constructs a set of execution arguments for a primitive.
+    ///
+    /// @param pd Primitive descriptor of the primitive that will be executed
+    ///     with the arguments.
+    exec_args(const primitive_desc_base &pd);
+
+    /// Constructs a set of execution arguments from <index, memory object>
+    /// pairs.
+    ///
+    /// @param args Vector of <index, memory object> pairs. The indices must
+    ///     be unique.
+    exec_args(const std::vector<std::pair<int, memory>> &args);
+
+    /// Sets an execution argument.
+    ///
+    /// Replacing a memory object for an index that is already in the set does
+    /// not allocate memory.
+    ///
+    /// @param arg Execution argument index, for example #DNNL_ARG_SRC.
+    /// @param amemory Memory object. If the set has been constructed for a
+    ///     primitive descriptor, the memory descriptor of the memory object
+    ///     must match the one returned by
+    ///     #dnnl::primitive_desc_base::query_md(#query::exec_arg_md, arg)
+    ///     unless using dynamic shapes (see #DNNL_RUNTIME_DIM_VAL).
+    void set(int arg, const memory &amemory);
+
+    /// Returns an execution argument.
+    ///
+    /// @param arg Execution argument index.
+    /// @returns The memory object. An empty memory object is returned if the
+    ///     set does not contain the argument.
+    memory get(int arg) const;
+
+    /// Returns the number of execution arguments in the set.
+    /// @returns The number of execution arguments.
+    int get_size() const;
 };
 
 /// @} dnnl_api_primitives_common
 
+/// @addtogroup dnnl_api_primitive_cache Primitive Cache
+///
+/// A process-wide cache of created primitives. Primitives are looked up
+/// in the cache by their operation descriptor, attributes, and engine.
+///
+/// @{
+
+/// Primitive cache statistics.
+struct primitive_cache_stats {
+    /// Number of primitive creation requests satisfied from the cache.
+    size_t hits;
+    /// Number of primitive creation requests that resulted in creating a
+    /// new primitive.
+    size_t misses;
+    /// Number of primitives evicted from the cache to keep the number of
+    /// cached primitives within the capacity.
+    size_t evictions;
+    /// Number of primitives currently stored in the cache.
+    size_t size;
+};
+
+/// Returns the primitive cache capacity.
+///
+/// @returns The maximum number of primitives the cache can hold.
+int get_primitive_cache_capacity();
+
+/// Sets the primitive cache capacity.
+///
+/// If the new capacity is less than the number of primitives currently
+/// stored in the cache, the least recently used primitives are evicted.
+/// Primitives that are already created by the user are not affected by the
+/// eviction.
+///
+/// @param capacity The maximum number of primitives the cache can hold.
+///     A value of 0 disables the cache.
+void set_primitive_cache_capacity(int capacity);
+
+/// Returns the primitive cache statistics accumulated since the library
+/// initialization or the last call to #reset_primitive_cache_stats().
+///
+/// @returns The primitive cache statistics.
+primitive_cache_stats get_primitive_cache_stats();
+
+/// Resets the hits, misses, and evictions counters of the primitive cache
+/// statistics to zero. The contents of the cache are not affected.
+void reset_primitive_cache_stats();
+
+/// @} dnnl_api_primitive_cache
+
+/// @addtogroup dnnl_api_profiling Profiling
+///
+/// Timing information about primitive executions collected by streams with
+/// profiling enabled.
+///
+/// @{
+
+/// A profiling record of a primitive execution.
+struct profiling_record {
+    /// Kind of the executed primitive.
+    primitive::kind kind;
+    /// Implementation name, as returned by
+    /// #dnnl::primitive_desc_base::impl_info_str().
+    std::string impl_info;
+    /// Execution argument indices and memory descriptors of the memory
+    /// objects the primitive was executed with.
+    std::vector<std::pair<int, memory::desc>> args;
+    /// Time it took to create the primitive, in milliseconds. For primitives
+    /// obtained from the primitive cache this is the time of the lookup.
+    double creation_time;
+    /// Execution time of the primitive, in milliseconds. On GPU engines this
+    /// is the device execution time.
+    double execution_time;
+    /// Whether this is the first execution of the primitive object. The
+    /// first execution may include implementation-specific initialization
+    /// and is usually excluded from the steady-state measurements.
+    bool first_execution;
+    /// Number of arithmetic operations performed by the primitive, as
+    /// defined by the specification of the primitive, or 0 if the number is
+    /// not defined for the primitive kind.
+    int64_t ops;
+    /// Total size of the memory objects the primitive was executed with, in
+    /// bytes, as returned by #dnnl::memory::desc::get_size().
+    int64_t bytes;
+};
+
+/// Profiling report formats.
+enum class profiling_format {
+    /// Comma-separated values with a header line and one line per record.
+    csv,
+    /// A JSON array with one object per record. The members of an object
+    /// are named after the members of #dnnl::profiling_record.
+    json,
+};
+
+/// Returns the profiling records collected by a stream.
+///
+/// Only the records of completed executions are returned. To obtain the
+/// records of all the submitted executions, call #dnnl::stream::wait() first.
+///
+/// @param astream Stream with profiling enabled.
+/// @returns Profiling records in the order of submission.
+std::vector<profiling_record> get_profiling_records(const stream &astream);
+
+/// Returns a profiling report for a stream.
+///
+/// @param astream Stream with profiling enabled.
+/// @param aformat Report format.
+/// @returns A report containing the profiling records of the completed
+///     executions, as returned by #get_profiling_records().
+std::string get_profiling_report(
+        const stream &astream, profiling_format aformat);
+
+/// Discards the profiling records collected by a stream.
+///
+/// @param astream Stream with profiling enabled.
+void reset_profiling(stream &astream);
+
+/// @} dnnl_api_profiling
+
 /// @addtogroup dnnl_api_reorder Reorder
 ///
 /// A primitive to copy data between two memory objects. This primitive is
@@ -1667,6 +2101,12 @@ struct reorder : public primitive {
     /// @param pd Primitive descriptor for reorder primitive.
     reorder(const primitive_desc &pd);
 
+    /// Constructs a reorder primitive from a cache blob.
+    /// @param pd Primitive descriptor for reorder primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    reorder(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
+
     /// Constructs a reorder primitive that would reorder data between memory
     /// objects having the same memory descriptors as memory objects @p src and
     /// @p dst.
@@ -1757,6 +2197,12 @@ struct concat : public primitive {
     /// Constructs a concatenation primitive.
     /// @param pd Primitive descriptor for concatenation primitive.
     concat(const primitive_desc &pd);
+
+    /// Constructs a concatenation primitive from a cache blob.
+    /// @param pd Primitive descriptor for concatenation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    concat(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_concat
@@ -1814,6 +2260,12 @@ struct sum : public primitive {
     /// Constructs a sum primitive.
     /// @param pd Primitive descriptor for sum primitive.
     sum(const primitive_desc &pd);
+
+    /// Constructs a sum primitive from a cache blob.
+    /// @param pd Primitive descriptor for sum primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    sum(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_sum
@@ -2017,6 +2469,15 @@ struct convolution_forward : public primitive {
     /// @param pd Primitive descriptor for a convolution forward propagation
     ///     primitive.
     convolution_forward(const primitive_desc &pd);
+
+    /// Constructs a convolution forward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a convolution forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    convolution_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Convolution backward propagation primitive.
@@ -2134,6 +2595,15 @@ struct convolution_backward_data : public primitive {
     /// @param pd Primitive descriptor for a convolution backward propagation
     ///     primitive.
     convolution_backward_data(const primitive_desc &pd);
+
+    /// Constructs a convolution backward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a convolution backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    convolution_backward_data(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Convolution weights gradient primitive.
@@ -2311,6 +2781,14 @@ struct convolution_backward_weights : public primitive {
     /// @param pd Primitive descriptor for a convolution weights gradient
     ///     primitive.
     convolution_backward_weights(const primitive_desc &pd);
+
+    /// Constructs a convolution weights gradient primitive from a cache blob.
+    /// @param pd Primitive descriptor for a convolution weights gradient
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    convolution_backward_weights(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_convolution
@@ -2495,6 +2973,15 @@ struct deconvolution_forward : public primitive {
     /// @param pd Primitive descriptor for a deconvolution forward propagation
     ///     primitive.
     deconvolution_forward(const primitive_desc &pd);
+
+    /// Constructs a deconvolution forward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a deconvolution forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    deconvolution_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Deconvolution backward propagation primitive.
@@ -2609,6 +3096,15 @@ struct deconvolution_backward_data : public primitive {
     /// @param pd Primitive descriptor for a deconvolution backward propagation
     ///     primitive.
     deconvolution_backward_data(const primitive_desc &pd);
+
+    /// Constructs a deconvolution backward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a deconvolution backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    deconvolution_backward_data(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Deconvolution weights gradient primitive.
@@ -2781,6 +3277,14 @@ struct deconvolution_backward_weights : public primitive {
     /// @param pd Primitive descriptor for a deconvolution weights gradient
     ///     primitive.
     deconvolution_backward_weights(const primitive_desc &pd);
+
+    /// Constructs a deconvolution weights gradient primitive from a cache blob.
+    /// @param pd Primitive descriptor for a deconvolution weights gradient
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    deconvolution_backward_weights(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_deconvolution
@@ -2861,6 +3365,13 @@ struct lrn_forward : public primitive {
     /// @param pd Primitive descriptor for an LRN forward propagation
     ///     primitive.
     lrn_forward(const primitive_desc &pd);
+
+    /// Constructs an LRN forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an LRN forward propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    lrn_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Local response normalization (LRN) backward propagation primitive.
@@ -2940,6 +3451,14 @@ struct lrn_backward : public primitive {
     /// @param pd Primitive descriptor for an LRN backward propagation
     ///     primitive.
     lrn_backward(const primitive_desc &pd);
+
+    /// Constructs an LRN backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an LRN backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    lrn_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_lrn
@@ -3025,6 +3544,14 @@ struct pooling_forward : public primitive {
     /// @param pd Primitive descriptor for a pooling forward propagation
     ///     primitive.
     pooling_forward(const primitive_desc &pd);
+
+    /// Constructs a pooling forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a pooling forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    pooling_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Pooling backward propagation primitive.
@@ -3108,6 +3635,14 @@ struct pooling_backward : public primitive {
     /// @param pd Primitive descriptor for a pooling backward propagation
     ///     primitive.
     pooling_backward(const primitive_desc &pd);
+
+    /// Constructs a pooling backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a pooling backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    pooling_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_pooling
@@ -3198,6 +3733,14 @@ struct eltwise_forward : public primitive {
     /// @param pd Primitive descriptor for an eltwise forward propagation
     ///     primitive.
     eltwise_forward(const primitive_desc &pd);
+
+    /// Constructs an eltwise forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an eltwise forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    eltwise_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Elementwise unary operation backward propagation primitive.
@@ -3280,6 +3823,14 @@ struct eltwise_backward : public primitive {
     /// @param pd Primitive descriptor for an eltwise backward propagation
     ///     primitive.
     eltwise_backward(const primitive_desc &pd);
+
+    /// Constructs an eltwise backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an eltwise backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    eltwise_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_eltwise
@@ -3355,6 +3906,14 @@ struct softmax_forward : public primitive {
     /// @param pd Primitive descriptor for a softmax forward propagation
     ///     primitive.
     softmax_forward(const primitive_desc &pd);
+
+    /// Constructs a softmax forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a softmax forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    softmax_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Softmax backward propagation primitive.
@@ -3433,6 +3992,14 @@ struct softmax_backward : public primitive {
     /// @param pd Primitive descriptor for a softmax backward propagation
     ///     primitive.
     softmax_backward(const primitive_desc &pd);
+
+    /// Constructs a softmax backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a softmax backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    softmax_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_softmax
@@ -3508,6 +4075,14 @@ struct logsoftmax_forward : public primitive {
     /// @param pd Primitive descriptor for a logsoftmax forward propagation
     ///     primitive.
     logsoftmax_forward(const primitive_desc &pd);
+
+    /// Constructs a logsoftmax forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a logsoftmax forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    logsoftmax_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Logsoftmax backward propagation primitive.
@@ -3586,6 +4161,15 @@ struct logsoftmax_backward : public primitive {
     /// @param pd Primitive descriptor for a logsoftmax backward propagation
     ///     primitive.
     logsoftmax_backward(const primitive_desc &pd);
+
+    /// Constructs a logsoftmax backward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a logsoftmax backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    logsoftmax_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_logsoftmax
@@ -3691,6 +4275,15 @@ struct batch_normalization_forward : public primitive {
     /// @param pd Primitive descriptor for a batch normalization forward
     ///     propagation primitive.
     batch_normalization_forward(const primitive_desc &pd);
+
+    /// Constructs a batch normalization forward propagation primitive from a
+    /// cache blob.
+    /// @param pd Primitive descriptor for a batch normalization forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    batch_normalization_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Batch normalization backward propagation primitive.
@@ -3791,6 +4384,15 @@ struct batch_normalization_backward : public primitive {
     /// @param pd Primitive descriptor for a batch normalization backward
     ///     propagation primitive.
     batch_normalization_backward(const primitive_desc &pd);
+
+    /// Constructs a batch normalization backward propagation primitive from a
+    /// cache blob.
+    /// @param pd Primitive descriptor for a batch normalization backward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    batch_normalization_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_batch_normalization
@@ -3907,6 +4509,15 @@ struct layer_normalization_forward : public primitive {
     /// @param pd Primitive descriptor for a layer normalization forward
     ///     propagation primitive.
     layer_normalization_forward(const primitive_desc &pd);
+
+    /// Constructs a layer normalization forward propagation primitive from a
+    /// cache blob.
+    /// @param pd Primitive descriptor for a layer normalization forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    layer_normalization_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Layer normalization backward propagation primitive.
@@ -4024,6 +4635,15 @@ struct layer_normalization_backward : public primitive {
     /// @param pd Primitive descriptor for a layer normalization backward
     ///     propagation primitive.
     layer_normalization_backward(const primitive_desc &pd);
+
+    /// Constructs a layer normalization backward propagation primitive from a
+    /// cache blob.
+    /// @param pd Primitive descriptor for a layer normalization backward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    layer_normalization_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_layer_normalization
@@ -4045,6 +4665,10 @@ struct inner_product_forward : public primitive {
         ///     All the memory descriptors may be initialized with the
         ///     #dnnl::memory::format_tag::any value of @p format_tag.
         ///
+        /// @note
+        ///     The minibatch dimension of @p src_desc and @p dst_desc may be
+        ///     set to #DNNL_RUNTIME_DIM_VAL.
+        ///
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
@@ -4063,6 +4687,10 @@ struct inner_product_forward : public primitive {
         ///     All the memory descriptors may be initialized with the
         ///     #dnnl::memory::format_tag::any value of @p format_tag.
         ///
+        /// @note
+        ///     The minibatch dimension of @p src_desc and @p dst_desc may be
+        ///     set to #DNNL_RUNTIME_DIM_VAL.
+        ///
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
@@ -4125,6 +4753,15 @@ struct inner_product_forward : public primitive {
     /// @param pd Primitive descriptor for an inner product forward
     ///     propagation primitive.
     inner_product_forward(const primitive_desc &pd);
+
+    /// Constructs an inner product forward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for an inner product forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    inner_product_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Inner product backward propagation primitive.
@@ -4205,6 +4842,15 @@ struct inner_product_backward_data : public primitive {
     /// @param pd Primitive descriptor for an inner product backward
     ///     propagation primitive.
     inner_product_backward_data(const primitive_desc &pd);
+
+    /// Constructs an inner product backward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for an inner product backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    inner_product_backward_data(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Inner product weights gradient primitive.
@@ -4303,6 +4949,15 @@ struct inner_product_backward_weights : public primitive {
     /// @param pd Primitive descriptor for an inner product weights gradient
     ///     primitive.
     inner_product_backward_weights(const primitive_desc &pd);
+
+    /// Constructs an inner product weights gradient primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for an inner product weights gradient
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    inner_product_backward_weights(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_inner_product
@@ -4520,6 +5175,15 @@ struct vanilla_rnn_forward : public primitive {
     /// @param pd Primitive descriptor for a vanilla RNN forward
     ///     propagation primitive.
     vanilla_rnn_forward(const primitive_desc &pd);
+
+    /// Constructs a vanilla RNN forward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a vanilla RNN forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    vanilla_rnn_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Vanilla RNN backward propagation primitive.
@@ -4689,6 +5353,15 @@ struct vanilla_rnn_backward : public primitive {
     /// @param pd Primitive descriptor for a vanilla RNN backward
     ///     propagation primitive.
     vanilla_rnn_backward(const primitive_desc &pd);
+
+    /// Constructs a vanilla RNN backward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a vanilla RNN backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    vanilla_rnn_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// LSTM forward propagation primitive.
@@ -4917,6 +5590,14 @@ struct lstm_forward : public primitive {
     /// @param pd Primitive descriptor for an LSTM forward propagation
     ///     primitive.
     lstm_forward(const primitive_desc &pd);
+
+    /// Constructs an LSTM forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an LSTM forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    lstm_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// LSTM backward propagation primitive.
@@ -5281,6 +5962,14 @@ struct lstm_backward : public primitive {
     /// @param pd Primitive descriptor for an LSTM backward propagation
     ///     primitive.
     lstm_backward(const primitive_desc &pd);
+
+    /// Constructs an LSTM backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an LSTM backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    lstm_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// GRU forward propagation primitive.
@@ -5389,6 +6078,13 @@ struct gru_forward : public primitive {
     /// @param pd Primitive descriptor for a GRU forward propagation
     ///     primitive.
     gru_forward(const primitive_desc &pd);
+
+    /// Constructs a GRU forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a GRU forward propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    gru_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// GRU backward propagation primitive.
@@ -5547,6 +6243,13 @@ struct gru_backward : public primitive {
     /// @param pd Primitive descriptor for a GRU backward propagation
     ///     primitive.
     gru_backward(const primitive_desc &pd);
+
+    /// Constructs a GRU backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a GRU backward propagation primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    gru_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// LBR GRU forward propagation primitive.
@@ -5657,6 +6360,14 @@ struct lbr_gru_forward : public primitive {
     /// @param pd Primitive descriptor for an LBR GRU forward propagation
     ///     primitive.
     lbr_gru_forward(const primitive_desc &pd);
+
+    /// Constructs an LBR GRU forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an LBR GRU forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    lbr_gru_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// LBR GRU backward propagation primitive.
@@ -5818,6 +6529,14 @@ struct lbr_gru_backward : public primitive {
     /// @param pd Primitive descriptor for an LBR GRU backward propagation
     ///     primitive.
     lbr_gru_backward(const primitive_desc &pd);
+
+    /// Constructs an LBR GRU backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an LBR GRU backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    lbr_gru_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_rnn
@@ -5879,6 +6598,14 @@ struct shuffle_forward : public primitive {
     /// @param pd Primitive descriptor for a shuffle forward propagation
     ///     primitive.
     shuffle_forward(const primitive_desc &pd);
+
+    /// Constructs a shuffle forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a shuffle forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    shuffle_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Shuffle backward propagation primitive.
@@ -5934,6 +6661,14 @@ struct shuffle_backward : public primitive {
     /// @param pd Primitive descriptor for a shuffle backward propagation
     ///     primitive.
     shuffle_backward(const primitive_desc &pd);
+
+    /// Constructs a shuffle backward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a shuffle backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    shuffle_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_shuffle
@@ -6009,6 +6744,13 @@ struct binary : public primitive {
     /// @param pd Primitive descriptor for an elementwise binary operation
     ///     primitive.
     binary(const primitive_desc &pd);
+
+    /// Constructs an elementwise binary operation primitive from a cache blob.
+    /// @param pd Primitive descriptor for an elementwise binary operation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    binary(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_binary
@@ -6026,6 +6768,10 @@ struct matmul : public primitive {
     struct desc {
         /// Constructs a descriptor for a matmul primitive.
         ///
+        /// @note
+        ///     Any of the M, N, K, and batch dimensions, as well as the
+        ///     strides, may be set to #DNNL_RUNTIME_DIM_VAL.
+        ///
         /// @param src_desc Memory descriptor for source (matrix A).
         /// @param weights_desc Memory descriptor for weights (matrix B).
         /// @param dst_desc Memory descriptor for destination (matrix C).
@@ -6034,6 +6780,10 @@ struct matmul : public primitive {
 
         /// Constructs a descriptor for a matmul primitive.
         ///
+        /// @note
+        ///     Any of the M, N, K, and batch dimensions, as well as the
+        ///     strides, may be set to #DNNL_RUNTIME_DIM_VAL.
+        ///
         /// @param src_desc Memory descriptor for source (matrix A).
         /// @param weights_desc Memory descriptor for weights (matrix B).
         /// @param dst_desc Memory descriptor for destination (matrix C).
@@ -6089,6 +6839,12 @@ struct matmul : public primitive {
     /// Constructs a matmul primitive.
     /// @param pd Primitive descriptor for a matmul primitive.
     matmul(const primitive_desc &pd);
+
+    /// Constructs a matmul primitive from a cache blob.
+    /// @param pd Primitive descriptor for a matmul primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    matmul(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_matmul
@@ -6205,6 +6961,14 @@ struct resampling_forward : public primitive {
     /// @param pd Primitive descriptor for a resampling forward propagation
     ///     primitive.
     resampling_forward(const primitive_desc &pd);
+
+    /// Constructs a resampling forward propagation primitive from a cache blob.
+    /// @param pd Primitive descriptor for a resampling forward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    resampling_forward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// Resampling backward propagation primitive.
@@ -6291,10 +7055,232 @@ struct resampling_backward : public primitive {
     /// @param pd Primitive descriptor for a resampling backward propagation
     ///     primitive.
     resampling_backward(const primitive_desc &pd);
+
+    /// Constructs a resampling backward propagation primitive from a cache
+    /// blob.
+    /// @param pd Primitive descriptor for a resampling backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    resampling_backward(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob);
 };
 
 /// @} dnnl_api_resampling
 
+/// @addtogroup dnnl_api_graph Graph
+///
+/// A directed acyclic graph of operations described by primitive
+/// descriptors. The library splits the graph into partitions, each of which
+/// is executed as a single primitive.
+///
+/// @{
+
+/// Partition primitive.
+struct partition : public primitive {
+    /// Primitive descriptor for a partition primitive.
+    struct primitive_desc : public dnnl::primitive_desc_base {
+        /// Default constructor. Produces an empty object.
+        primitive_desc();
+
+        /// Returns the indices of the graph operations that belong to the
+        /// partition.
+        /// @returns The indices of the operations in the order of their
+        ///     execution.
+        std::vector<size_t> get_ops() const;
+
+        /// Returns whether the partition fuses several operations.
+        /// @returns True if the partition consists of more than one operation
+        ///     and false otherwise.
+        bool is_fused() const;
+
+        /// Returns the number of inputs of the partition.
+        /// @returns The number of inputs.
+        int get_num_inputs() const;
+
+        /// Returns the number of outputs of the partition.
+        /// @returns The number of outputs.
+        int get_num_outputs() const;
+
+        /// Returns the graph operation argument that corresponds to an input
+        /// of the partition.
+        /// @param idx Input index.
+        /// @returns A pair of the operation index in the graph and the
+        ///     execution argument index of the operation, for example
+        ///     #DNNL_ARG_SRC_1.
+        std::pair<size_t, int> get_input(int idx) const;
+
+        /// Returns the graph operation argument that corresponds to an output
+        /// of the partition.
+        /// @param idx Output index.
+        /// @returns A pair of the operation index in the graph and the
+        ///     execution argument index of the operation, for example
+        ///     #DNNL_ARG_DST.
+        std::pair<size_t, int> get_output(int idx) const;
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc(int)const
+        memory::desc src_desc(int idx = 0) const;
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc(int)const
+        memory::desc dst_desc(int idx = 0) const;
+    };
+
+    /// Default constructor. Produces an empty object.
+    partition();
+
+    /// Constructs a partition primitive.
+    /// @param pd Primitive descriptor for a partition primitive.
+    partition(const primitive_desc &pd);
+
+    /// Constructs a partition primitive from a cache blob.
+    /// @param pd Primitive descriptor for a partition primitive.
+    /// @param cache_blob Cache blob produced by
+    ///     #dnnl::primitive::get_cache_blob().
+    partition(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob);
+};
+
+/// A graph of operations.
+struct graph {
+    /// Graph partitioning policies.
+    enum class policy {
+        /// Each operation forms a separate partition.
+        none,
+        /// Operations are fused into partitions whenever the implementation
+        /// supports the fusion. The remaining operations form separate
+        /// partitions.
+        fusion,
+    };
+
+    /// Constructs an empty graph.
+    ///
+    /// @param aengine Engine the operations of the graph are created on.
+    graph(const engine &aengine);
+
+    /// Adds an operation to the graph.
+    ///
+    /// @param pd Primitive descriptor describing the operation. The primitive
+    ///     descriptor must be created on the engine of the graph.
+    /// @returns The index of the operation in the graph.
+    size_t add_op(const primitive_desc_base &pd);
+
+    /// Connects an output of one operation to an input of another operation.
+    ///
+    /// The memory descriptor of the output must be equal to the memory
+    /// descriptor of the input, as returned by
+    /// #dnnl::primitive_desc_base::query_md(#query::exec_arg_md, arg).
+    /// Connections must not form cycles.
+    ///
+    /// @param src_op Index of the producing operation.
+    /// @param src_arg Execution argument index of the output of the producing
+    ///     operation, for example #DNNL_ARG_DST.
+    /// @param dst_op Index of the consuming operation.
+    /// @param dst_arg Execution argument index of the input of the consuming
+    ///     operation, for example #DNNL_ARG_SRC.
+    void connect(size_t src_op, int src_arg, size_t dst_op, int dst_arg);
+
+    /// Marks an output of an operation as a graph output.
+    ///
+    /// Outputs that are not connected to any other operation are graph
+    /// outputs automatically. This function is required only for outputs that
+    /// are both consumed by other operations and needed by the user.
+    ///
+    /// @param op Index of the operation.
+    /// @param arg Execution argument index of the output.
+    void mark_output(size_t op, int arg);
+
+    /// Returns the number of operations in the graph.
+    /// @returns The number of operations.
+    size_t get_num_ops() const;
+
+    /// Splits the graph into partitions.
+    ///
+    /// Each operation belongs to exactly one partition. The partitions are
+    /// returned in an order in which they can be executed.
+    ///
+    /// @param apolicy Partitioning policy.
+    /// @returns Primitive descriptors of the partitions.
+    std::vector<partition::primitive_desc> get_partitions(
+            policy apolicy = policy::fusion) const;
+};
+
+/// @} dnnl_api_graph
+
+/// @addtogroup dnnl_api_primitive_sequence Primitive Sequence
+///
+/// A fixed sequence of primitive executions recorded once and submitted to a
+/// stream as a whole.
+///
+/// @{
+
+/// A recorded sequence of primitive executions.
+struct primitive_sequence {
+    /// Constructs an empty sequence. An empty sequence cannot be used in any
+    /// operations.
+    primitive_sequence();
+
+    /// Constructs a sequence for the specified engine.
+    ///
+    /// @param aengine Engine the primitives of the sequence are created on.
+    primitive_sequence(const engine &aengine);
+
+    /// Appends a primitive execution to the sequence.
+    ///
+    /// The arguments are captured by the sequence. Memory objects are
+    /// captured as handles: a change of the data handle of a memory object
+    /// via #dnnl::memory::set_data_handle() takes effect at the next
+    /// execution of the sequence. The memory descriptors of the memory
+    /// objects must not change.
+    ///
+    /// @param aprimitive Primitive to append. The primitive must be created
+    ///     on the engine of the sequence.
+    /// @param args Arguments map, as for #dnnl::primitive::execute().
+    void append(const primitive &aprimitive,
+            const std::unordered_map<int, memory> &args);
+
+    /// Appends a primitive execution to the sequence.
+    ///
+    /// @param aprimitive Primitive to append. The primitive must be created
+    ///     on the engine of the sequence.
+    /// @param args Execution arguments, as for #dnnl::primitive::execute().
+    ///     Memory objects are captured as handles, the same way as for the
+    ///     arguments map.
+    void append(const primitive &aprimitive, const exec_args &args);
+
+    /// Finalizes the sequence.
+    ///
+    /// Validates the arguments of all the appended executions and prepares
+    /// the sequence for submission. No executions can be appended after this
+    /// call.
+    void finalize();
+
+    /// Returns the number of primitive executions in the sequence.
+    /// @returns The number of primitive executions.
+    size_t get_size() const;
+
+    /// Executes the sequence in the specified stream.
+    ///
+    /// The primitives are executed in the order they have been appended, as
+    /// if #dnnl::primitive::execute() was called for each of them, but with a
+    /// single submission to the stream.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the sequence.
+    void execute(const stream &astream) const;
+
+    /// Executes the sequence in the specified stream.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the sequence.
+    /// @param deps Optional vector with `cl::sycl::event` dependencies of the
+    ///     first primitive execution.
+    /// @returns An event that signals the completion of the last primitive
+    ///     execution.
+    cl::sycl::event execute_sycl(const stream &astream,
+            const std::vector<cl::sycl::event> &deps = {}) const;
+};
+
+/// @} dnnl_api_primitive_sequence
+
 /// @} dnnl_api_primitives
 
 } // namespace dnnl
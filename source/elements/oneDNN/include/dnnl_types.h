@@ -176,6 +176,18 @@
 /// Zero points provided at execution time.
 #define DNNL_ARG_ATTR_ZERO_POINTS 4096
 
+/// Arguments for fused depthwise convolution.
+/// See @ref dnnl::post_ops::append_dw.
+#define DNNL_ARG_ATTR_POST_OP_DW 8192
+
+/// Starting point for a binary post operation.
+#define DNNL_ARG_ATTR_MULTIPLE_POST_OP_BASE 16384
+
+/// Arguments for a binary post operation. Up to 32 arguments are supported.
+/// See @ref dnnl::post_ops::append_binary.
+#define DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) \
+    (DNNL_ARG_ATTR_MULTIPLE_POST_OP_BASE * ((idx) + 1))
+
 /// A wildcard value for dimensions that are unknown at a primitive creation
 /// time.
 #define DNNL_RUNTIME_DIM_VAL INT64_MIN
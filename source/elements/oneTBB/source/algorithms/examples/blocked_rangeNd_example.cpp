@@ -22,22 +22,28 @@ int main() {
     const int out_heigth = feature_maps_heigth - kernel_height + 1;
 
     // Initializes feature maps with 1 in each cell and out with zeros.
-    std::vector<std::vector<std::vector<float>>> feature_maps(feature_maps_length, std::vector<std::vector<float>>(feature_maps_width, std::vector<float>(feature_maps_heigth, 1.0f)));
-    std::vector<std::vector<std::vector<float>>> out(out_length, std::vector<std::vector<float>>(out_width, std::vector<float>(out_heigth, 0.f)));
-
-    // 3D convolution calculates sum of all elements in kernel
-    convolution3d(feature_maps, out,
-                  out_length, out_width, out_heigth,
-                  kernel_length, kernel_width, kernel_height);
+    // Each array is stored in one contiguous block of memory.
+    std::vector<float> feature_maps_data(feature_maps_length * feature_maps_width * feature_maps_heigth, 1.0f);
+    std::vector<float> out_data(out_length * out_width * out_heigth, 0.f);
+
+    array3d_view<const float> feature_maps(feature_maps_data.data(),
+                                           feature_maps_length, feature_maps_width, feature_maps_heigth);
+    array3d_view<float> out(out_data.data(), out_length, out_width, out_heigth);
+
+    // 3D convolution calculates sum of all elements in kernel.
+    // Repeated calls with the same partitioner replay the assignment of tiles to threads,
+    // so each thread finds the input of its tiles in its cache.
+    tbb::affinity_partitioner partitioner;
+    for (int iteration = 0; iteration < 4; ++iteration) {
+        convolution3d(feature_maps, out,
+                      kernel_length, kernel_width, kernel_height,
+                      partitioner);
+    }
 
     // Checks correctness of convolution by equality to expected sum of elements
     float expected = float(kernel_length * kernel_height * kernel_width);
-    for (auto i : out) {
-        for (auto j : i) {
-            for (auto k : j) {
-                __TBB_ASSERT_RELEASE(k == expected, "convolution fails to calculate correctly");
-            }
-        }
+    for (float value : out_data) {
+        __TBB_ASSERT_RELEASE(value == expected, "convolution fails to calculate correctly");
     }
 #endif /* __TBB_CPP11_PRESENT && __TBB_CPP11_ARRAY_PRESENT && __TBB_CPP11_TEMPLATE_ALIASES_PRESENT */
     return 0;
@@ -1,40 +1,86 @@
-#define TBB_PREVIEW_BLOCKED_RANGE_ND 1
 #include "tbb/blocked_rangeNd.h"
 
 #include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
 
-template<typename Features>
-float kernel3d(const Features& feature_maps, int i, int j, int k,
-               int kernel_length, int kernel_width, int kernel_height) {
+#include <cstddef>
+
+// Non-owning view of a row-major 3D array stored in one contiguous block of memory.
+// A subview of a tile refers to the same memory and keeps the strides of the whole array,
+// so the innermost dimension of every tile is contiguous.
+template<typename T>
+class array3d_view {
+public:
+    array3d_view(T* data, int length, int width, int height)
+        : my_data(data), my_length(length), my_width(width), my_height(height),
+          my_row_stride(height), my_page_stride(std::ptrdiff_t(width) * height) {}
+
+    T& operator()(int i, int j, int k) const {
+        return my_data[i * my_page_stride + j * my_row_stride + k];
+    }
+
+    // Pointer to the contiguous innermost row at (i, j)
+    T* row(int i, int j) const { return &(*this)(i, j, 0); }
+
+    array3d_view subview(const tbb::blocked_rangeNd<int, 3>& r) const {
+        array3d_view view(*this);
+        view.my_data = &(*this)(r.dim(0).begin(), r.dim(1).begin(), r.dim(2).begin());
+        view.my_length = int(r.dim(0).size());
+        view.my_width = int(r.dim(1).size());
+        view.my_height = int(r.dim(2).size());
+        return view;
+    }
+
+    int length() const { return my_length; }
+    int width() const { return my_width; }
+    int height() const { return my_height; }
+
+private:
+    T* my_data;
+    int my_length, my_width, my_height;
+    std::ptrdiff_t my_row_stride, my_page_stride;
+};
+
+inline float kernel3d(array3d_view<const float> feature_maps, int i, int j, int k,
+                      int kernel_length, int kernel_width, int kernel_height) {
     float result = 0.f;
 
     for (int feature_i = i; feature_i < i + kernel_length; ++feature_i)
-        for (int feature_j = j; feature_j < j + kernel_width; ++feature_j)
-            for (int feature_k = k; feature_k < k + kernel_width; ++feature_k)
-                result += feature_maps[feature_i][feature_j][feature_k];
+        for (int feature_j = j; feature_j < j + kernel_width; ++feature_j) {
+            // Unit-stride access to a contiguous row can be vectorized by the compiler
+            const float* row = feature_maps.row(feature_i, feature_j) + k;
+            for (int feature_k = 0; feature_k < kernel_height; ++feature_k)
+                result += row[feature_k];
+        }
 
     return result;
 }
 
-template<typename Features, typename Output>
-void convolution3d(const Features& feature_maps, Output& out,
-                   int out_length, int out_width, int out_heigth,
-                   int kernel_length, int kernel_width, int kernel_height) {
+inline void convolution3d(array3d_view<const float> feature_maps, array3d_view<float> out,
+                          int kernel_length, int kernel_width, int kernel_height,
+                          tbb::affinity_partitioner& partitioner) {
     using range_t = tbb::blocked_rangeNd<int, 3>;
+    using dim_range_t = tbb::blocked_range<int>;
 
+    // Per-dimension grain sizes bound the tile size, so the input window of a tile stays in cache.
+    // The innermost dimension is not split to keep the accesses of a tile contiguous.
     tbb::parallel_for(
-        range_t({0, out_length}, {0, out_width}, {0, out_heigth}),
+        range_t(dim_range_t(0, out.length(), 8), dim_range_t(0, out.width(), 4),
+                dim_range_t(0, out.height(), out.height())),
         [&](const range_t& out_range) {
-            auto out_x = out_range.dim(0);
-            auto out_y = out_range.dim(1);
-            auto out_z = out_range.dim(2);
-
-            for (int i = out_x.begin(); i < out_x.end(); ++i)
-                for (int j = out_y.begin(); j < out_y.end(); ++j)
-                    for (int k = out_z.begin(); k < out_z.end(); ++k)
-                        out[i][j][k] = kernel3d(feature_maps, i, j, k,
-                                                kernel_length, kernel_width, kernel_height);
-        }
+            auto out_tile = out.subview(out_range);
+            const int i0 = out_range.dim(0).begin();
+            const int j0 = out_range.dim(1).begin();
+            const int k0 = out_range.dim(2).begin();
+
+            for (int i = 0; i < out_tile.length(); ++i)
+                for (int j = 0; j < out_tile.width(); ++j) {
+                    float* out_row = out_tile.row(i, j);
+                    for (int k = 0; k < out_tile.height(); ++k)
+                        out_row[k] = kernel3d(feature_maps, i0 + i, j0 + j, k0 + k,
+                                              kernel_length, kernel_width, kernel_height);
+                }
+        },
+        partitioner
     );
 }
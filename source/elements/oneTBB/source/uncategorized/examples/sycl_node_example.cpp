@@ -0,0 +1,108 @@
+#define TBB_PREVIEW_FLOW_GRAPH_NODES 1
+#define TBB_PREVIEW_FLOW_GRAPH_FEATURES 1
+
+#include "tbb/flow_graph_sycl_node.h"
+
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+// A vector in USM device memory. Copies of the object refer to the same memory.
+struct usm_vector {
+    int* data;
+    int size;
+};
+
+int main() {
+    using namespace tbb::flow;
+
+    const int vector_size = 10;
+
+    // The default selector chooses a GPU device if available
+    sycl::queue queue;
+
+    usm_vector vec     = { sycl::malloc_device<int>(vector_size, queue), vector_size };
+    usm_vector cubed   = { sycl::malloc_device<int>(vector_size, queue), vector_size };
+    usm_vector squared = { sycl::malloc_device<int>(vector_size, queue), vector_size };
+
+    // The result is read on the host, so it is allocated in shared memory
+    int* sum = sycl::malloc_shared<int>(1, queue);
+
+    graph g;
+
+    broadcast_node< device_msg<usm_vector> > broadcast(g);
+
+    // Device computation part. The bodies only submit kernels and never wait for them.
+    sycl_node< usm_vector > vector_cuber(g, queue,
+        [=](sycl::queue& q, const usm_vector& in, usm_vector& out,
+            const std::vector<sycl::event>& dependencies) {
+            out = cubed;
+            return q.submit([&](sycl::handler& h) {
+                h.depends_on(dependencies);
+                const int* src = in.data;
+                int* dst = out.data;
+                h.parallel_for(sycl::range<1>(in.size), [=](sycl::id<1> i) {
+                    dst[i] = src[i] * src[i] * src[i];
+                });
+            });
+        });
+
+    sycl_node< usm_vector > vector_squarer(g, queue,
+        [=](sycl::queue& q, const usm_vector& in, usm_vector& out,
+            const std::vector<sycl::event>& dependencies) {
+            out = squared;
+            return q.submit([&](sycl::handler& h) {
+                h.depends_on(dependencies);
+                const int* src = in.data;
+                int* dst = out.data;
+                h.parallel_for(sycl::range<1>(in.size), [=](sycl::id<1> i) {
+                    dst[i] = src[i] * src[i];
+                });
+            });
+        });
+
+    // The kernel of the summer starts after the kernels of both predecessors complete
+    sycl_node< std::tuple< usm_vector, usm_vector >, int* > summer(g, queue,
+        [=](sycl::queue& q, const std::tuple< usm_vector, usm_vector >& in, int*& out,
+            const std::vector<sycl::event>& dependencies) {
+            out = sum;
+            return q.submit([&](sycl::handler& h) {
+                h.depends_on(dependencies);
+                const int* vect_cubed = std::get<0>(in).data;
+                const int* vect_squared = std::get<1>(in).data;
+                int* result = out;
+                h.single_task([=]() {
+                    *result = 0;
+                    for (int i = 0; i < vector_size; i++) {
+                        *result += vect_cubed[i] + vect_squared[i];
+                    }
+                });
+            });
+        });
+
+    // Host part. The graph waits for the device only when the result reaches this node.
+    function_node< int* > printer(g, serial, [](int* result) {
+        std::cout << "Sum is " << *result << "\n";
+    });
+
+    // Graph topology
+    make_edge( broadcast, vector_cuber );
+    make_edge( broadcast, vector_squarer );
+    make_edge( vector_cuber, input_port<0>(summer) );
+    make_edge( vector_squarer, input_port<1>(summer) );
+    make_edge( summer, printer );
+
+    // Data initialization on the device
+    sycl::event initialized = queue.fill(vec.data, 2, vector_size);
+
+    // Run the graph
+    broadcast.try_put( device_msg<usm_vector>(vec, initialized) );
+    g.wait_for_all();
+
+    sycl::free(vec.data, queue);
+    sycl::free(cubed.data, queue);
+    sycl::free(squared.data, queue);
+    sycl::free(sum, queue);
+
+    return 0;
+}
@@ -32,6 +32,52 @@ enum {
     MFX_EXTBUFF_BRC = MFX_MAKEFOURCC('E','B','R','C')
 };
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*! See the mfxExtBRCLookAheadStat structure for details. */
+enum {
+    MFX_EXTBUFF_BRC_LOOKAHEAD_STAT = MFX_MAKEFOURCC('B','L','A','S')
+};
+
+MFX_PACK_BEGIN_USUAL_STRUCT()
+/*!
+   The mfxBRCLookAheadFrameStat structure describes complexity statistics of one frame of the lookahead window, collected by the
+   encoder during hardware lookahead and motion estimation. Costs are sums of the per-block costs of the frame in implementation-specific
+   units, which are the same for all frames of the session.
+*/
+typedef struct {
+    mfxU32 DisplayOrder;    /*!< The frame number in a sequence of frames in display order starting from last IDR. */
+    mfxU16 FrameType;       /*!< Planned frame type, see FrameType enumerator. */
+    mfxU16 SceneChange;     /*!< Frame belongs to a new scene if non zero. */
+    mfxU32 IntraCost;       /*!< Estimated cost of the frame coded as intra frame. */
+    mfxU32 InterCost;       /*!< Estimated cost of the frame coded as inter frame with reference to the previous frame. Zero for the first frame of a scene. */
+    mfxU32 PropagationCost; /*!< Estimated amount of information of the frame used for prediction of the subsequent frames of the window. */
+    mfxU32 reserved[11];
+} mfxBRCLookAheadFrameStat;
+MFX_PACK_END()
+
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+/*!
+   The mfxExtBRCLookAheadStat structure provides lookahead complexity statistics to the external BRC. If the encoder was initialized
+   with mfxExtCodingOption2::ExtBRC and mfxExtCodingOption2::LookAheadDepth greater than zero, the encoder attaches this buffer to the
+   mfxBRCFrameParam structure passed to mfxExtBRC::GetFrameCtrl. The buffer and the arrays it points to are owned by the encoder and are
+   valid only during the callback.
+*/
+typedef struct {
+    mfxExtBuffer Header;                  /*!< Extension buffer header. Header.BufferId must be equal to MFX_EXTBUFF_BRC_LOOKAHEAD_STAT. */
+    mfxU16 NumFrame;                      /*!< Number of frames in FrameStat. The first element describes the frame to be encoded, the rest describe the following frames in display order. */
+    mfxU16 BlockSize;                     /*!< Size of the square blocks of BlockIntraCost, BlockInterCost and BlockPropagationCost in pixels, for example 16 or 32.
+                                               May differ from the block size of the mfxExtMBQP QP map, which is 16 for AVC and mfxExtMBQP::BlockSize for HEVC.
+                                               Block i corresponds to entry i of the QP map only when the block sizes are equal. */
+    mfxU32 NumBlock;                      /*!< Number of blocks of the frame to be encoded, in raster scan order. */
+    mfxBRCLookAheadFrameStat* FrameStat;  /*!< Pointer to the array of per-frame statistics. */
+    mfxU32* BlockIntraCost;               /*!< Pointer to the array of intra costs of blocks of the frame to be encoded. */
+    mfxU32* BlockInterCost;               /*!< Pointer to the array of inter costs of blocks of the frame to be encoded. */
+    mfxU32* BlockPropagationCost;         /*!< Pointer to the array of propagation costs of blocks of the frame to be encoded. */
+    mfxU32 reserved[8];
+} mfxExtBRCLookAheadStat;
+MFX_PACK_END()
+#endif
+
 MFX_PACK_BEGIN_STRUCT_W_PTR()
 /*!
    The mfxBRCFrameParam structure describes frame parameters required for external BRC functions.
@@ -51,8 +97,8 @@ typedef struct {
     mfxU16 FrameType;       /*!< See FrameType enumerator */
     mfxU16 PyramidLayer;    /*!< B-pyramid or P-pyramid layer, frame belongs to. */
     mfxU16 NumRecode;       /*!< Number of recodings performed for this frame. */
-    mfxU16 NumExtParam;     /*!< Reserved for the future use. */
-    mfxExtBuffer** ExtParam;/*!< Reserved for the future use. */
+    mfxU16 NumExtParam;     /*!< The number of extended buffers attached by the encoder. */
+    mfxExtBuffer** ExtParam;/*!< Array of extended buffers attached by the encoder, for example mfxExtBRCLookAheadStat. */
 } mfxBRCFrameParam;
 MFX_PACK_END()
 
@@ -80,8 +126,10 @@ typedef struct {
                                          If repacking feature is on ( maxFrameSize & maxNumRePak are not zero), it is calculated by encoder. */
     mfxU16 MaxNumRepak;             /*!< Number of possible repacks in driver if current frame size > maxFrameSize. Ignored if maxFrameSize==0.
                                          See maxFrameSize description. Possible values are [0,8]. */
-    mfxU16 NumExtParam;             /*!< Reserved for the future use. */
-    mfxExtBuffer** ExtParam;        /*!< Reserved for the future use. */
+    mfxU16 NumExtParam;             /*!< The number of extended buffers attached by the encoder. */
+    mfxExtBuffer** ExtParam;        /*!< Array of extended buffers attached by the encoder. If mfxExtCodingOption3::EnableMBQP was turned ON
+                                         during encoder initialization, the encoder attaches the mfxExtMBQP buffer with QP array allocated for
+                                         the frame; the BRC can fill it to set per-block QP or set NumQPAlloc to 0 to use frame-level QpY only. */
 #else
     mfxU32 reserved1[13];
     mfxHDL reserved2;
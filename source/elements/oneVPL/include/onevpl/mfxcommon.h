@@ -372,6 +372,16 @@ MFX_PACK_END()
 typedef enum {
     MFX_IMPLCAPS_IMPLDESCSTRUCTURE       = 1  /*!< Deliver capabilities as mfxImplDescription structure. */ 
 } mfxImplCapsDeliveryFormat;
+
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*! The mfxSchedulingPolicy enumerator specifies how the loader distributes sessions between adapters. */
+typedef enum {
+    MFX_SCHEDULING_POLICY_DEFAULT      = 0, /*!< Implementations are ordered by the priority rules of the dispatcher only. */
+    MFX_SCHEDULING_POLICY_LEAST_LOADED = 1  /*!< Hardware implementations of the same library running on different adapters are
+                                                 ordered by the current load of the adapters at each call of MFXEnumImplementations
+                                                 and MFXCreateSession, so the least loaded adapter has the lowest index. */
+} mfxSchedulingPolicy;
+#endif
 #endif
 
 #ifdef __cplusplus
@@ -207,6 +207,106 @@ mfxStatus MFX_CDECL MFXCreateSession(mfxLoader loader, mfxU32 i, mfxSession* ses
 */
 mfxStatus MFX_CDECL MFXDispReleaseImplDescription(mfxLoader loader, mfxHDL hdl);
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*!
+   @brief This function enables the persistent implementation capabilities cache of the loader.
+   @details Without the cache, the loader loads every shared library found in the search folders and calls
+            MFXQueryImplCapabilities for each of them. With the cache enabled, the loader stores the collected
+            mfxImplDescription structures in the cache file and reuses them in subsequent processes. A cache entry is keyed by
+            the full path, the API version and the modification time of the library, so an updated or replaced library is
+            queried again and its entry is refreshed automatically.
+
+            The cache also enables lazy loading: MFXSetConfigFilterProperty filters are applied to the cached descriptions, and
+            only the implementation selected by MFXCreateSession is loaded. MFXEnumImplementations returns the cached
+            descriptions without loading the libraries.
+
+            The function must be called before the first call of MFXEnumImplementations or MFXCreateSession for the loader.
+            If the ONEVPL_CAPS_CACHE_PATH environment variable is set, the cache is enabled for every loader with the file
+            specified by the variable, unless the application calls this function.
+
+            Usage example:
+            @code
+               mfxLoader loader = MFXLoad();
+               MFXSetCapsCache(loader, (const mfxChar*)"/var/cache/onevpl/caps.bin");
+               mfxConfig cfg = MFXCreateConfig(loader);
+               mfxVariant ImplValue;
+               ImplValue.Type = MFX_VARIANT_TYPE_U32;
+               ImplValue.Data.U32 = MFX_IMPL_HARDWARE;
+               MFXSetConfigFilterProperty(cfg,"mfxImplDescription.Impl",ImplValue);
+               MFXCreateSession(loader,0,&session); // only the matching library is loaded
+            @endcode
+
+   @param[in] loader SDK loader handle.
+   @param[in] path Null-terminated path of the cache file. The file is created if it does not exist. NULL disables the cache.
+
+   @return
+      MFX_ERR_NONE               The function completed successfully. \n
+      MFX_ERR_NULL_PTR           If loader is NULL. \n
+      MFX_ERR_UNDEFINED_BEHAVIOR If implementations of the loader were already enumerated. \n
+      MFX_ERR_UNSUPPORTED        If the cache file cannot be created or opened.
+*/
+mfxStatus MFX_CDECL MFXSetCapsCache(mfxLoader loader, const mfxChar* path);
+
+/*!
+   @brief This function sets the policy the loader uses to distribute sessions between adapters.
+   @details With MFX_SCHEDULING_POLICY_LEAST_LOADED, the loader orders hardware implementations of the same library which run on
+            different adapters by the load of the adapters. The load is estimated from the live media engine utilization and the
+            number of sessions of each adapter, as reported by mfxAdapterInfo::EngineUtilization and mfxAdapterInfo::NumSessions.
+            The order is updated at each call of MFXEnumImplementations and MFXCreateSession, so an application which always creates
+            sessions with index 0 spreads them over all suitable adapters. Implementations of different libraries and software
+            implementations keep the order defined by the priority rules of the dispatcher.
+
+            Usage example:
+            @code
+               mfxLoader loader = MFXLoad();
+               MFXSetSchedulingPolicy(loader, MFX_SCHEDULING_POLICY_LEAST_LOADED);
+               for (int i = 0; i < num_streams; i++)
+                  MFXCreateSession(loader, 0, &session[i]); // each session goes to the least loaded adapter
+            @endcode
+
+   @param[in] loader SDK loader handle.
+   @param[in] policy Scheduling policy. See mfxSchedulingPolicy enumerator for details.
+
+   @return
+      MFX_ERR_NONE        The function completed successfully. \n
+      MFX_ERR_NULL_PTR    If loader is NULL. \n
+      MFX_ERR_UNSUPPORTED If policy is unknown.
+*/
+mfxStatus MFX_CDECL MFXSetSchedulingPolicy(mfxLoader loader, mfxSchedulingPolicy policy);
+
+/*!
+   @brief This function moves a session to the adapter of another implementation of the same library.
+   @details The session handle stays valid and the components of the session are re-initialized on the new adapter with their current
+            parameters. The application must call this function at a point where no reference frames are needed: for an encoder,
+            at a GOP boundary after all submitted frames are synchronized, with the next frame encoded as an IDR frame; for a decoder,
+            before the bitstream data of a new closed GOP is submitted. Surfaces allocated by the session on the old adapter must be
+            released before the call. The session must not be joined with other sessions.
+
+            Usage example:
+            @code
+               // drain the encoder at the end of a GOP
+               while (MFX_ERR_NONE == MFXVideoENCODE_EncodeFrameAsync(session, NULL, NULL, bs, &syncp))
+                  MFXVideoCORE_SyncOperation(session, syncp, MFX_INFINITE);
+               MFXMigrateSession(loader, session, 0); // re-balance to the least loaded adapter
+               ctrl.FrameType = MFX_FRAMETYPE_I | MFX_FRAMETYPE_IDR | MFX_FRAMETYPE_REF;
+               MFXVideoENCODE_EncodeFrameAsync(session, &ctrl, surface, bs, &syncp);
+            @endcode
+
+   @param[in] loader  SDK loader handle the session was created with.
+   @param[in] session SDK session handle.
+   @param[in] i       Index of the target implementation, with the same meaning as in MFXCreateSession.
+
+   @return
+      MFX_ERR_NONE               The function completed successfully. The session runs on the adapter of implementation i. \n
+      MFX_ERR_NULL_PTR           If loader is NULL. \n
+      MFX_ERR_INVALID_HANDLE     If session was not created by this loader. \n
+      MFX_ERR_NOT_FOUND          Provided index is out of possible range. \n
+      MFX_ERR_UNSUPPORTED        If implementation i is provided by a different library than the session. \n
+      MFX_ERR_UNDEFINED_BEHAVIOR If the session has tasks in progress, holds surfaces of the old adapter, or is joined.
+*/
+mfxStatus MFX_CDECL MFXMigrateSession(mfxLoader loader, mfxSession session, mfxU32 i);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -52,7 +52,11 @@ MFX_PACK_BEGIN_USUAL_STRUCT()
 /*! The mfxFrameInfo structure specifies properties of video frames. See also "Configuration Parameter Constraints" chapter. */
 typedef struct {
     mfxU32  reserved[4]; /*!< Reserbed for future use. */
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    mfxU16  ChannelId;   /*!< ID of the output channel of the fused decode and video processing pipeline. See MFXVideoDECODE_VPP_Init. */
+#else
     mfxU16  reserved4;   /*!< Reserbed for future use. */
+#endif
     /*! Number of bits used to represent luma samples.
         @note Not all codecs and SDK implementations support this value. Use Query function to check if this feature is supported. */
     mfxU16  BitDepthLuma;
@@ -404,8 +408,47 @@ typedef enum
      * \attention This flag is optional
      */
     MFX_MAP_NOWAIT = 0x10 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    ,
+    /*!
+     * The surface is mapped in place: pointers of mfxFrameSurface1::Data point directly to the memory of the surface, without a staging copy.
+     * The mapping fails with MFX_ERR_UNSUPPORTED if the layout of the surface reported by mfxFrameSurfaceInterface::QueryLayout has CpuAccess
+     * different from MFX_SURFACE_CPU_ACCESS_DIRECT.
+     */
+    MFX_MAP_DIRECT = 0x20
+#endif
 } mfxMemoryFlags;
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*! The SurfaceTiling enumerator itemizes memory layouts of surface planes. */
+enum {
+    MFX_SURFACE_TILING_LINEAR = 0, /*!< Rows of each plane are stored one after another with the plane pitch. */
+    MFX_SURFACE_TILING_OTHER  = 1  /*!< Implementation-specific tiled layout. The surface cannot be accessed directly by CPU. */
+};
+
+/*! The SurfaceCpuAccess enumerator itemizes kinds of CPU access to the memory of a surface. */
+enum {
+    MFX_SURFACE_CPU_ACCESS_NONE    = 0, /*!< The memory is not accessible by CPU. */
+    MFX_SURFACE_CPU_ACCESS_STAGING = 1, /*!< Map copies the surface to or from a staging buffer. */
+    MFX_SURFACE_CPU_ACCESS_DIRECT  = 2  /*!< The surface can be mapped in place with the MFX_MAP_DIRECT flag. */
+};
+
+MFX_PACK_BEGIN_USUAL_STRUCT()
+/*! The mfxSurfaceLayout structure describes the memory layout of a surface. */
+typedef struct {
+    mfxStructVersion Version;   /*!< The version of the structure. */
+    mfxU16           Tiling;    /*!< Memory layout of the planes; see the SurfaceTiling enumerator. */
+    mfxU16           CpuAccess; /*!< Kind of CPU access to the surface memory; see the SurfaceCpuAccess enumerator. */
+    mfxU16           Coherent;  /*!< Non zero if CPU and device caches are coherent for the surface memory, so no flush is needed after
+                                     the surface is mapped with MFX_MAP_DIRECT. Otherwise, Map and Unmap perform the necessary cache maintenance. */
+    mfxU16           NumPlanes; /*!< Number of planes of the surface. */
+    mfxU32           Pitch[4];  /*!< Pitch of each plane in bytes. */
+    mfxU32           Offset[4]; /*!< Offset of each plane in bytes from the beginning of the surface memory. */
+    mfxU32           reserved[8];
+} mfxSurfaceLayout;
+MFX_PACK_END()
+#endif
+
 //typedef struct _mfxFrameSurfaceInterface mfxFrameSurfaceInterface;
 
 /* Frame Surface */
@@ -588,11 +631,84 @@ typedef struct mfxFrameSurfaceInterface {
      MFX_ERR_UNKNOWN            in case of any internal error. 
     */
     mfxStatus           (MFX_CDECL *Synchronize)(mfxFrameSurface1* surface, mfxU32 wait);
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    /*! @brief
+    This function returns the memory layout of the surface: tiling, pitches and offsets of the planes, and whether the surface can be mapped
+    in place with the MFX_MAP_DIRECT flag. The pointer is NULL if the implementation does not support the query.
+
+    @param[in]   surface  valid surface.
+    @param[out]  layout   pointer to the mfxSurfaceLayout structure.
+
+    @return
+     MFX_ERR_NONE               if no error. \n
+     MFX_ERR_NULL_PTR           if surface or layout is NULL. \n
+     MFX_ERR_INVALID_HANDLE     if mfxFrameSurfaceInterface->Context is invalid (for example NULL). \n
+     MFX_ERR_UNKNOWN            in case of any internal error.
+    */
+    mfxStatus           (MFX_CDECL *QueryLayout)(mfxFrameSurface1* surface, mfxSurfaceLayout* layout);
+    mfxHDL              reserved2[3];
+#else
     mfxHDL              reserved2[4];
+#endif
 } mfxFrameSurfaceInterface;
 MFX_PACK_END()
 #endif
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+/*! The mfxSurfaceArray structure specifies a reference counted array of surfaces returned by the fused decode and video
+    processing pipeline. */
+typedef struct mfxSurfaceArray {
+    mfxHDL              Context; /*!< This context of memory interface. User should not touch (change, set, null) this pointer. */
+    mfxStructVersion    Version; /*!< The version of the structure. */
+    mfxU16              reserved[3];
+    /*! @brief
+    This function increments the internal reference counter of the array. The array and the surfaces it contains cannot be
+    destroyed until user calls (*Release).
+
+    @param[in]  surface_array  valid array.
+
+    @return
+     MFX_ERR_NONE              if no error. \n
+     MFX_ERR_NULL_PTR          if surface_array is NULL. \n
+     MFX_ERR_INVALID_HANDLE    if mfxSurfaceArray->Context is invalid (for example NULL). \n
+     MFX_ERR_UNKNOWN           in case of any internal error.
+    */
+    mfxStatus           (MFX_CDECL *AddRef)(struct mfxSurfaceArray* surface_array);
+    /*! @brief
+    This function decrements the internal reference counter of the array. Surfaces of the array that were not referenced
+    separately with mfxFrameSurfaceInterface::AddRef are released together with the array.
+
+    @param[in]  surface_array  valid array.
+
+    @return
+     MFX_ERR_NONE               if no error. \n
+     MFX_ERR_NULL_PTR           if surface_array is NULL. \n
+     MFX_ERR_INVALID_HANDLE     if mfxSurfaceArray->Context is invalid (for example NULL). \n
+     MFX_ERR_UNDEFINED_BEHAVIOR if Reference Counter of array is zero before call. \n
+     MFX_ERR_UNKNOWN            in case of any internal error.
+    */
+    mfxStatus           (MFX_CDECL *Release)(struct mfxSurfaceArray* surface_array);
+    /*! @brief
+    This function returns current reference counter of mfxSurfaceArray structure.
+
+    @param[in]   surface_array  valid array.
+    @param[out]  counter        sets counter to the current reference counter value.
+
+    @return
+     MFX_ERR_NONE               if no error. \n
+     MFX_ERR_NULL_PTR           if surface_array or counter is NULL. \n
+     MFX_ERR_INVALID_HANDLE     if mfxSurfaceArray->Context is invalid (for example NULL). \n
+     MFX_ERR_UNKNOWN            in case of any internal error.
+    */
+    mfxStatus           (MFX_CDECL *GetRefCounter)(struct mfxSurfaceArray* surface_array, mfxU32* counter);
+    mfxFrameSurface1**  Surfaces;    /*!< The array of pointers to surfaces. mfxFrameInfo::ChannelId of each surface identifies its channel. */
+    mfxU32              NumSurfaces; /*!< The number of surfaces in the array. */
+    mfxU32              reserved1;
+} mfxSurfaceArray;
+MFX_PACK_END()
+#endif
+
 /*! The TimeStampCalc enumerator itemizes time-stamp calculation methods. */
 enum {
     /*! The time stamp calculation is to base on the input frame rate, if time stamp is not explicitly specified. */
@@ -809,6 +925,24 @@ typedef struct {
 } mfxVideoParam;
 MFX_PACK_END()
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+/*! The mfxVideoChannelParam structure contains configuration parameters of one output channel of the fused decode and video
+    processing pipeline. */
+typedef struct {
+    /*! Configurations of video processing of the channel. VPP.In is ignored, the input of each channel is the decoded frame.
+        VPP.Out.ChannelId must be unique among channels and must not be 0, which is reserved for the decoder output. */
+    mfxInfoVPP      VPP;
+    mfxU16          Protected; /*!< Specifies the content protection mechanism; see the Protected enumerator for a list of supported protection schemes. */
+    /*! Output memory access type of the channel; see the enumerator IOPattern for details. Only output patterns are allowed. */
+    mfxU16          IOPattern;
+    mfxExtBuffer**  ExtParam;    /*!< Points to an array of pointers to the video processing configuration structures of the channel. */
+    mfxU16          NumExtParam; /*!< The number of extra configuration structures attached to this structure. */
+    mfxU16          reserved[7];
+} mfxVideoChannelParam;
+MFX_PACK_END()
+#endif
+
 /*! The IOPattern enumerator itemizes memory access patterns for SDK functions. Use bit-ORed values to specify an input access
     pattern and an output access pattern. */
 enum {
@@ -2028,6 +2162,30 @@ enum {
     */
     MFX_EXTBUFF_PARTIAL_BITSTREAM_PARAM         = MFX_MAKEFOURCC('P','B','O','P'),
 #endif
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    /*!
+       See the mfxExtPartialBitstreamInfo structure for details. The application can attach this buffer to the mfxBitstream structure
+       before calling MFXVideoENCODE_EncodeFrameAsync function.
+    */
+    MFX_EXTBUFF_PARTIAL_BITSTREAM_INFO          = MFX_MAKEFOURCC('P','B','O','I'),
+    /*!
+       See the mfxExtPerformanceStat structure for details. The application can attach this buffer to the mfxVideoParam structure
+       before calling Init function to enable collection of performance statistics, and to the mfxEncodeStat, mfxDecodeStat or
+       mfxVPPStat structure to retrieve them.
+    */
+    MFX_EXTBUFF_PERFORMANCE_STAT                = MFX_MAKEFOURCC('P','S','T','A'),
+    /*!
+       See the mfxExtFramePerformanceStat structure for details. The application can attach this buffer to the mfxBitstream structure
+       before calling MFXVideoENCODE_EncodeFrameAsync function, or to the mfxFrameData structure of the output surface before calling
+       MFXVideoDECODE_DecodeFrameAsync or MFXVideoVPP_RunFrameVPPAsync functions.
+    */
+    MFX_EXTBUFF_FRAME_PERFORMANCE_STAT          = MFX_MAKEFOURCC('F','P','S','T'),
+    /*!
+       See the mfxExtVPPTensorOutput structure for details. The application can attach this buffer to the mfxVideoChannelParam
+       structure before calling MFXVideoDECODE_VPP_Init function to make the channel output a tensor.
+    */
+    MFX_EXTBUFF_VPP_TENSOR_OUTPUT               = MFX_MAKEFOURCC('V','T','N','S'),
+#endif
 
 #if (MFX_VERSION >= 1034)
    /*!
@@ -2107,7 +2265,18 @@ MFX_PACK_BEGIN_STRUCT_W_L_TYPE()
    The mfxEncodeStat structure returns statistics collected during encoding.
 */
 typedef struct {
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    /*! @internal :unnamed(union) @endinternal */
+    union {
+        struct {
+            mfxExtBuffer **ExtParam; /*!< Array of extended buffers for additional statistics. See the mfxExtPerformanceStat structure. */
+            mfxU16  NumExtParam;     /*!< The number of extended buffers attached to this structure. */
+        };
+        mfxU32  reserved[16];
+    };
+#else
     mfxU32  reserved[16];
+#endif
     mfxU32  NumFrame;       /*!< Number of encoded frames. */
     mfxU64  NumBit;         /*!< Number of bits for all encoded frames. */
     mfxU32  NumCachedFrame; /*!< Number of internally cached frames. */
@@ -2119,7 +2288,18 @@ MFX_PACK_BEGIN_USUAL_STRUCT()
    The mfxDecodeStat structure returns statistics collected during decoding.
 */
 typedef struct {
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    /*! @internal :unnamed(union) @endinternal */
+    union {
+        struct {
+            mfxExtBuffer **ExtParam; /*!< Array of extended buffers for additional statistics. See the mfxExtPerformanceStat structure. */
+            mfxU16  NumExtParam;     /*!< The number of extended buffers attached to this structure. */
+        };
+        mfxU32  reserved[16];
+    };
+#else
     mfxU32  reserved[16];
+#endif
     mfxU32  NumFrame;        /*!< Number of total decoded frames. */
     mfxU32  NumSkippedFrame; /*!< Number of skipped frames. */
     mfxU32  NumError;        /*!< Number of errors recovered. */
@@ -2132,12 +2312,70 @@ MFX_PACK_BEGIN_USUAL_STRUCT()
    The mfxVPPStat structure returns statistics collected during video processing.
 */
 typedef struct {
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    /*! @internal :unnamed(union) @endinternal */
+    union {
+        struct {
+            mfxExtBuffer **ExtParam; /*!< Array of extended buffers for additional statistics. See the mfxExtPerformanceStat structure. */
+            mfxU16  NumExtParam;     /*!< The number of extended buffers attached to this structure. */
+        };
+        mfxU32  reserved[16];
+    };
+#else
     mfxU32  reserved[16];
+#endif
     mfxU32  NumFrame;       /*!< Total number of frames processed. */
     mfxU32  NumCachedFrame; /*!< Number of internally cached frames. */
 } mfxVPPStat;
 MFX_PACK_END()
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+MFX_PACK_BEGIN_STRUCT_W_L_TYPE()
+/*!
+   The mfxExtPerformanceStat structure returns aggregated performance statistics of the component. Collection of the statistics is
+   disabled by default because it may add overhead. It is enabled when this buffer is attached to the mfxVideoParam structure passed to
+   the Init or Reset function of the component; the content of the buffer is ignored in this case.
+   The statistics are returned when this buffer is attached to the mfxEncodeStat, mfxDecodeStat or mfxVPPStat structure passed to the
+   corresponding GetStat function. All times are in microseconds and are accumulated since Init or the last Reset.
+
+   Queue time is the time between submission of a frame by the Async function and the start of its execution on the device; execution
+   time is the time of the execution on the device. A high queue time with a low execution time indicates that the device is shared with
+   other workloads; a low queue time with a low number of tasks in the queue indicates that the application does not submit enough work.
+*/
+typedef struct {
+    mfxExtBuffer    Header;             /*!< Extension buffer header. Header.BufferId must be equal to MFX_EXTBUFF_PERFORMANCE_STAT. */
+    mfxU32          NumFrame;           /*!< Number of frames the statistics are collected for. */
+    mfxU32          reserved1;
+    mfxU64          TotalQueueTime;     /*!< Sum of the queue times of all frames. */
+    mfxU64          TotalExecutionTime; /*!< Sum of the device execution times of all frames. */
+    mfxU32          MaxQueueTime;       /*!< Maximum queue time of a frame. */
+    mfxU32          MaxExecutionTime;   /*!< Maximum device execution time of a frame. */
+    mfxU16          NumTaskInQueue;     /*!< Number of tasks submitted by the component and not yet completed. */
+    mfxU16          MaxTaskInQueue;     /*!< Maximum value of NumTaskInQueue. */
+    mfxU16          NumSurfaceInUse;    /*!< Number of internally allocated surfaces of the component which are currently in use. */
+    mfxU16          MaxSurfaceInUse;    /*!< Maximum value of NumSurfaceInUse. */
+    mfxU16          NumSurfaceTotal;    /*!< Total number of internally allocated surfaces of the component. */
+    mfxU16          reserved[11];
+} mfxExtPerformanceStat;
+MFX_PACK_END()
+
+MFX_PACK_BEGIN_USUAL_STRUCT()
+/*!
+   The mfxExtFramePerformanceStat structure returns performance statistics of a single frame. The buffer is filled when the operation
+   which processes the frame is synchronized. Collection of the statistics must be enabled with the mfxExtPerformanceStat buffer.
+   All times are in microseconds.
+*/
+typedef struct {
+    mfxExtBuffer    Header;          /*!< Extension buffer header. Header.BufferId must be equal to MFX_EXTBUFF_FRAME_PERFORMANCE_STAT. */
+    mfxU32          QueueTime;       /*!< Time between submission of the frame and the start of its execution on the device. */
+    mfxU32          ExecutionTime;   /*!< Time of the execution of the frame on the device. */
+    mfxU16          NumTaskInQueue;  /*!< Number of tasks of the component in the queue when the frame was submitted. */
+    mfxU16          NumSurfaceInUse; /*!< Number of internally allocated surfaces of the component in use when the frame was submitted. */
+    mfxU16          reserved[10];
+} mfxExtFramePerformanceStat;
+MFX_PACK_END()
+#endif
+
 MFX_PACK_BEGIN_USUAL_STRUCT()
 /*!
    The mfxExtVppAuxData structure returns auxiliary data generated by the video processing pipeline.
@@ -2301,6 +2539,10 @@ enum {
                                                considered to be exported to DRM Prime FD, DRM FLink or DRM FrameBuffer Handle. Specifics of export
                                                types and export procedure depends on external frame allocator implementation */
     MFX_MEMTYPE_SHARED_RESOURCE = MFX_MEMTYPE_EXPORT_FRAME, /*!< For DX11 allocation use shared resource bind flag. */
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    MFX_MEMTYPE_CPU_DIRECT_ACCESS = 0x0004, /*!< Video memory frames must be allocated in linear layout in memory directly accessible by CPU,
+                                                 for example in unified memory of an integrated device, so they can be mapped with MFX_MAP_DIRECT. */
+#endif
 #if (MFX_VERSION >= 1025)
     MFX_MEMTYPE_VIDEO_MEMORY_ENCODER_TARGET = 0x1000 /*!< Frames are in video memory and belong to video encoder render targets. */
 #else
@@ -3710,6 +3952,50 @@ typedef struct {
 } mfxExtVPPScaling;
 MFX_PACK_END()
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*! The TensorLayout enumerator itemizes orders of dimensions of a tensor. */
+enum {
+    MFX_TENSOR_LAYOUT_NCHW = 1, /*!< Batch, channel, height, width. Each color channel of a picture is a separate plane. */
+    MFX_TENSOR_LAYOUT_NHWC = 2  /*!< Batch, height, width, channel. Color channels of a pixel are interleaved. */
+};
+
+/*! The TensorDataType enumerator itemizes types of tensor elements. */
+enum {
+    MFX_TENSOR_DATA_TYPE_U8  = 1, /*!< 8-bit unsigned integer. Mean and Scale of mfxExtVPPTensorOutput are ignored. */
+    MFX_TENSOR_DATA_TYPE_F16 = 2, /*!< 16-bit IEEE 754 floating point. */
+    MFX_TENSOR_DATA_TYPE_F32 = 3  /*!< 32-bit IEEE 754 floating point. */
+};
+
+/*! The TensorChannelOrder enumerator itemizes orders of color channels in a tensor. */
+enum {
+    MFX_TENSOR_CHANNEL_ORDER_RGB = 1, /*!< Red, green, blue. */
+    MFX_TENSOR_CHANNEL_ORDER_BGR = 2  /*!< Blue, green, red. */
+};
+
+MFX_PACK_BEGIN_USUAL_STRUCT()
+/*!
+   The mfxExtVPPTensorOutput structure configures a channel of the fused decode and video processing pipeline to write its
+   output as pictures of a batch of a dense tensor in the memory provided by the application, instead of producing surfaces.
+   The height H and width W of the tensor are VPP.Out.CropH and VPP.Out.CropW of the channel; each decoded picture is
+   resized to them with the scaling filter of the channel, converted to the color channels specified by ChannelOrder and
+   normalized. A value v of a color channel c in the range of 0 to 255 is stored as (v - Mean[c]) * Scale[c].
+   The channel order of Mean and Scale is the order specified by ChannelOrder.
+   The tensor contains BatchSize * 3 * H * W elements without padding.
+*/
+typedef struct {
+    mfxExtBuffer Header;       /*!< Extension buffer header. Header.BufferId must be equal to MFX_EXTBUFF_VPP_TENSOR_OUTPUT. */
+
+    mfxU16       Layout;       /*!< Order of dimensions of the tensor. See TensorLayout for possible values. */
+    mfxU16       DataType;     /*!< Type of the elements of the tensor. See TensorDataType for possible values. */
+    mfxU16       ChannelOrder; /*!< Order of color channels. See TensorChannelOrder for possible values. */
+    mfxU16       BatchSize;    /*!< Maximum number of pictures N in the tensor. */
+    mfxF32       Mean[3];      /*!< Value subtracted from each color channel before scaling. */
+    mfxF32       Scale[3];     /*!< Factor each color channel is multiplied by after the mean is subtracted. */
+    mfxU16       reserved[16];
+} mfxExtVPPTensorOutput;
+MFX_PACK_END()
+#endif
+
 #if (MFX_VERSION >= MFX_VERSION_NEXT)
 
 /* SceneChangeType */
@@ -4174,7 +4460,14 @@ typedef struct
     mfxU32      Number;   /*!< Value which uniquely characterizes media adapter. On windows this number can be used for initialization through
                                DXVA interface (see <a href="https://docs.microsoft.com/en-us/windows/win32/api/dxgi/nf-dxgi-idxgifactory1-enumadapters1">example</a>). */
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    mfxU16      EngineUtilization; /*!< Utilization of the busiest media engine of the adapter in percent, averaged over the last second.
+                                        The value is sampled when the function returning the structure is called. */
+    mfxU16      NumSessions;       /*!< Number of SDK sessions currently running on the adapter in all processes. */
+    mfxU16      reserved[12];
+#else
     mfxU16      reserved[14];
+#endif
 } mfxAdapterInfo;
 MFX_PACK_END()
 
@@ -4223,6 +4516,34 @@ typedef struct {
 MFX_PACK_END()
 #endif
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+/*!
+   This structure is used by an encoder to report which parts of the bitstream are complete when partial bitstream output is enabled with
+   the mfxExtPartialBitstreamParam buffer and Granularity equal to MFX_PARTIAL_BITSTREAM_SLICE. The application can attach this extended
+   buffer to the mfxBitstream structure before calling MFXVideoENCODE_EncodeFrameAsync. The structure is updated each time
+   MFXVideoCORE_SyncOperation returns MFX_ERR_NONE_PARTIAL_OUTPUT or MFX_ERR_NONE for the corresponding sync point, so the application
+   can send each complete slice as soon as it is encoded.
+
+   The number of slices is configured with mfxInfoMFX::NumSlice, mfxExtCodingOption2::MaxSliceSize, or mfxExtCodingOption3::NumSliceI,
+   NumSliceP and NumSliceB.
+
+   @note Not all codecs and SDK implementations support this feature. Use Query function to check if this feature is supported.
+*/
+typedef struct {
+    mfxExtBuffer    Header;        /*!< Extension buffer header. Header.BufferId must be equal to MFX_EXTBUFF_PARTIAL_BITSTREAM_INFO. */
+    mfxU16          NumSliceReady; /*!< Output. Number of slices of the current frame which are completely written to the bitstream. */
+    mfxU16          NumSliceTotal; /*!< Output. Number of slices in the current frame, or 0 if it is not known yet, for example with MaxSliceSize. */
+    mfxU16          NumSliceAlloc; /*!< Number of elements allocated by the application in the SliceSize array. */
+    mfxU16          reserved[5];
+    /*! Output. Sizes in bytes of the first min(NumSliceReady, NumSliceAlloc) slices of the frame, in bitstream order. Slice i starts at
+        offset mfxBitstream::DataOffset plus the sum of sizes of the previous slices. The frame headers are included in the first slice. */
+    mfxU32*         SliceSize;
+    mfxU32          reserved1[4];
+} mfxExtPartialBitstreamInfo;
+MFX_PACK_END()
+#endif
+
 #if (MFX_VERSION >= 1034)
 MFX_PACK_BEGIN_USUAL_STRUCT()
 /*!
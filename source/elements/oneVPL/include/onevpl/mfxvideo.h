@@ -169,7 +169,10 @@ mfxStatus MFX_CDECL MFXVideoCORE_QueryPlatform(mfxSession session, mfxPlatform*
 /*!
    @brief
     This function initiates execution of an asynchronous function not already started and returns the status code after the specified asynchronous operation completes.
-    If wait is zero, the function returns immediately
+    If wait is zero, the function returns immediately.
+    If syncp is an aggregated sync point returned by MFXVideoDECODE_DecodeFrameBatchAsync or MFXVideoENCODE_EncodeFrameBatchAsync,
+    session can be any session of the batch and the function waits for completion of all tasks of the batch. In case of an error,
+    the function returns the status of the first failed task; the status of each task can be checked with its own sync point.
 
    @param[in] session SDK session handle.
    @param[in] syncp Sync point
@@ -183,6 +186,68 @@ mfxStatus MFX_CDECL MFXVideoCORE_QueryPlatform(mfxSession session, mfxPlatform*
 */
 mfxStatus MFX_CDECL MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfxU32 wait);
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*!
+   @brief
+    The completion callback type. The SDK calls the callback from an internal SDK thread once when the asynchronous
+    operation associated with the sync point completes or is aborted. If partial bitstream output is enabled for the encoder,
+    the SDK also calls the callback with status MFX_ERR_NONE_PARTIAL_OUTPUT once for each portion of the bitstream that becomes
+    available before the completion. The callback must return quickly and must not call SDK functions other than
+    MFXVideoCORE_SyncOperation with zero wait.
+
+   @param[in] syncp Sync point of the completed operation.
+   @param[in] status Completion status, the same that MFXVideoCORE_SyncOperation returns for the sync point.
+   @param[in] user_data User data passed to MFXVideoCORE_SetSyncCallback.
+*/
+typedef void (MFX_CDECL *mfxSyncCallback)(mfxSyncPoint syncp, mfxStatus status, mfxHDL user_data);
+
+/*! The mfxSyncHandleType enumerator itemizes types of OS handles which are signaled on completion of an asynchronous operation. */
+typedef enum {
+    MFX_SYNC_HANDLE_WIN32_EVENT = 1, /*!< Windows* event HANDLE. The event is signaled on completion. */
+    MFX_SYNC_HANDLE_FD          = 2  /*!< Linux* file descriptor, returned as (mfxHDL)(intptr_t)fd. The descriptor becomes readable on completion and can be used with poll, select and epoll. */
+} mfxSyncHandleType;
+
+/*!
+   @brief
+    This function registers a completion callback for the asynchronous operation associated with the sync point. If the
+    operation has already completed, the callback is called before the function returns.
+    Registering a callback does not release the sync point: the application must call MFXVideoCORE_SyncOperation
+    (zero wait is sufficient after the callback was called) to retrieve the final status.
+
+   @param[in] session SDK session handle.
+   @param[in] syncp Sync point.
+   @param[in] callback Completion callback.
+   @param[in] user_data User data passed to the callback as is.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_NULL_PTR syncp or callback is NULL. \n
+   MFX_ERR_INVALID_HANDLE session or syncp is not valid. \n
+   MFX_ERR_UNDEFINED_BEHAVIOR A callback is already registered for the sync point.
+*/
+mfxStatus MFX_CDECL MFXVideoCORE_SetSyncCallback(mfxSession session, mfxSyncPoint syncp, mfxSyncCallback callback, mfxHDL user_data);
+
+/*!
+   @brief
+    This function returns an OS handle which is signaled when the asynchronous operation associated with the sync point
+    completes, so one application thread can wait for many operations using OS facilities such as WaitForMultipleObjects,
+    I/O completion ports or epoll. The handle is owned by the SDK and stays valid until MFXVideoCORE_SyncOperation returns
+    a status other than MFX_WRN_IN_EXECUTION for the sync point, or until the session is closed.
+
+   @param[in] session SDK session handle.
+   @param[in] syncp Sync point.
+   @param[in] type Requested handle type; see the mfxSyncHandleType enumerator.
+   @param[out] handle Pointer to the returned handle.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_NULL_PTR syncp or handle is NULL. \n
+   MFX_ERR_INVALID_HANDLE session or syncp is not valid. \n
+   MFX_ERR_UNSUPPORTED The handle type is not supported by the OS or by the implementation.
+*/
+mfxStatus MFX_CDECL MFXVideoCORE_GetSyncHandle(mfxSession session, mfxSyncPoint syncp, mfxSyncHandleType type, mfxHDL* handle);
+#endif
+
 #if (MFX_VERSION >= 2000)
 /* MFXMemory */
 
@@ -248,6 +313,107 @@ mfxStatus MFX_CDECL MFXMemory_GetSurfaceForEncode(mfxSession session, mfxFrameSu
 mfxStatus MFX_CDECL MFXMemory_GetSurfaceForDecode(mfxSession session, mfxFrameSurface1** surface);
 #endif
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*! Surface pool handle. The pool is shared between sessions created on the same device. */
+typedef struct _mfxSurfacePool *mfxSurfacePool;
+
+/*!
+   @brief
+      This function creates a pool of reference counted surfaces which can be shared between sessions created on the same
+      device. The session becomes attached to the pool. Surfaces of the pool are allocated by the SDK internally and
+      have the same properties as surfaces returned by MFXMemory_GetSurfaceForXXX functions.
+      The pool should be released with MFXMemory_ReleaseSurfacePool after usage.
+
+   @param[in]  session SDK session handle. The session must have the hardware acceleration device handle set or created internally.
+   @param[in]  request Pointer to the mfxFrameAllocRequest structure that specifies the surface properties, memory type and
+                       the minimal number of surfaces. The number of surfaces can grow on demand up to NumFrameSuggested
+                       if NumFrameSuggested is not less than NumFrameMin, or without limit if NumFrameSuggested is 0.
+   @param[out] pool    Pointer to the surface pool handle.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_NULL_PTR If request or pool is NULL. \n
+   MFX_ERR_INVALID_HANDLE If session was not initialized. \n
+   MFX_ERR_UNSUPPORTED If the requested memory type is not supported by the device of the session. \n
+   MFX_ERR_MEMORY_ALLOC In case of any other internal allocation error.
+*/
+mfxStatus MFX_CDECL MFXMemory_CreateSurfacePool(mfxSession session, mfxFrameAllocRequest* request, mfxSurfacePool* pool);
+
+/*!
+   @brief
+      This function attaches a session to a surface pool created by another session. After this call, internal surface
+      allocations of the session for frames compatible with the pool (DECODE output surfaces with NULL working surface,
+      VPP output surfaces and MFXMemory_GetSurfaceForXXX) are served from the pool, and surfaces of the pool can be passed as
+      input to any component of the session without copy. The session must use the same device as the session which
+      created the pool. Unlike MFXJoinSession, the sessions keep independent schedulers.
+
+   @param[in]  session SDK session handle.
+   @param[in]  pool    Surface pool handle.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_INVALID_HANDLE If session or pool is not valid. \n
+   MFX_ERR_UNDEFINED_BEHAVIOR If the session is already attached to a surface pool. \n
+   MFX_ERR_UNSUPPORTED If the session uses a device different from the device of the pool.
+*/
+mfxStatus MFX_CDECL MFXMemory_AttachSurfacePool(mfxSession session, mfxSurfacePool pool);
+
+/*!
+   @brief
+      This function returns a free surface of the pool. Surface should be released with
+      mfxFrameSurface1::FrameInterface.Release(...) after usage. Value of mfxFrameSurface1::Data.Locked for returned surface is 0.
+
+   @param[in]  pool    Surface pool handle.
+   @param[out] surface Pointer is set to valid mfxFrameSurface1 object.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_NULL_PTR If surface is NULL. \n
+   MFX_ERR_INVALID_HANDLE If pool is not valid. \n
+   MFX_WRN_DEVICE_BUSY If all surfaces of the pool are in use and the pool cannot grow. \n
+   MFX_ERR_MEMORY_ALLOC In case of any other internal allocation error.
+*/
+mfxStatus MFX_CDECL MFXMemory_GetSurfaceFromPool(mfxSurfacePool pool, mfxFrameSurface1** surface);
+
+/*!
+   @brief
+      This function releases the pool handle. Surfaces of the pool which are still referenced by the application or by SDK
+      components stay valid until their reference counters reach zero. The pool is destroyed after all sessions attached to
+      the pool are closed and all of its surfaces are released.
+
+   @param[in]  pool    Surface pool handle.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_INVALID_HANDLE If pool is not valid.
+*/
+mfxStatus MFX_CDECL MFXMemory_ReleaseSurfacePool(mfxSurfacePool pool);
+
+/*!
+   @brief
+      This function wraps a native resource allocated by the application or by another component into a reference counted
+      mfxFrameSurface1 object without copying the frame data. The resource must be created on the device used by the session.
+      The imported surface can be passed to any component of the session and to sessions attached to the same surface pool.
+      The SDK does not take ownership of the resource: the application must keep it alive until the reference counter of the
+      imported surface reaches zero. To export a surface, use mfxFrameSurfaceInterface::GetNativeHandle and
+      mfxFrameSurfaceInterface::GetDeviceHandle while holding a reference to the surface.
+
+   @param[in]  session       SDK session handle.
+   @param[in]  resource      Native handle of the resource.
+   @param[in]  resource_type Type of native resource (see mfxResourceType enumeration).
+   @param[in]  info          Pointer to the mfxFrameInfo structure that describes the resource.
+   @param[out] surface       Pointer is set to valid mfxFrameSurface1 object.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_NULL_PTR If resource, info or surface is NULL. \n
+   MFX_ERR_INVALID_HANDLE If session was not initialized. \n
+   MFX_ERR_UNSUPPORTED If the resource type is not supported or the resource was created on a different device.
+*/
+mfxStatus MFX_CDECL MFXMemory_ImportFrameSurface(mfxSession session, mfxHDL resource, mfxResourceType resource_type,
+                                                 mfxFrameInfo* info, mfxFrameSurface1** surface);
+#endif
+
 /* VideoENCODE */
 
 /*!
@@ -372,6 +538,7 @@ mfxStatus MFX_CDECL MFXVideoENCODE_GetVideoParam(mfxSession session, mfxVideoPar
 /*!
    @brief 
     This function obtains statistics collected during encoding.
+    Attach the mfxExtPerformanceStat buffer to the mfxEncodeStat structure to obtain performance statistics.
     
    @param[in] session SDK session handle.
    @param[in] stat  Pointer to the mfxEncodeStat structure
@@ -415,6 +582,43 @@ mfxStatus MFX_CDECL MFXVideoENCODE_GetEncodeStat(mfxSession session, mfxEncodeSt
 */
 mfxStatus MFX_CDECL MFXVideoENCODE_EncodeFrameAsync(mfxSession session, mfxEncodeCtrl *ctrl, mfxFrameSurface1 *surface, mfxBitstream *bs, mfxSyncPoint *syncp);
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+/*! The mfxEncodeFrameTask structure describes one task of the batched encoding submission. The fields Session, Ctrl, Surface
+    and Bs have the same meaning as the corresponding arguments of MFXVideoENCODE_EncodeFrameAsync. */
+typedef struct {
+    mfxSession          Session;   /*!< SDK session handle. The encoder of the session must be initialized. */
+    mfxEncodeCtrl*      Ctrl;      /*!< Pointer to the mfxEncodeCtrl structure for per-frame encoding control. */
+    mfxFrameSurface1*   Surface;   /*!< Pointer to the frame surface structure. */
+    mfxBitstream*       Bs;        /*!< Pointer to the output bitstream. */
+    mfxSyncPoint        SyncPoint; /*!< Output. Sync point of the task. Valid only if Status is MFX_ERR_NONE. */
+    mfxStatus           Status;    /*!< Output. Status the task would get from MFXVideoENCODE_EncodeFrameAsync. */
+    mfxU32              reserved[3];
+} mfxEncodeFrameTask;
+MFX_PACK_END()
+
+/*!
+   @brief
+    This function submits several encoding tasks at once. The tasks may belong to one or several sessions; all sessions must
+    use the same device. Each task is processed as if MFXVideoENCODE_EncodeFrameAsync was called with its arguments, in the
+    order of the tasks array, but the per-call submission overhead is paid once for the whole batch.
+    The function returns an aggregated sync point which is signaled when all tasks with Status equal to MFX_ERR_NONE are
+    completed. The application can wait for it with MFXVideoCORE_SyncOperation using any session of the batch.
+    The tasks array can be reused by the application right after the function returns.
+
+   @param[in,out] tasks Pointer to the array of mfxEncodeFrameTask structures.
+   @param[in] num_tasks Number of elements in tasks.
+   @param[out] syncp Pointer to the aggregated sync point. Set to NULL if no task was submitted.
+
+   @return
+   MFX_ERR_NONE The function completed successfully; the status of each task is returned in its Status field. \n
+   MFX_ERR_NULL_PTR tasks or syncp is NULL. \n
+   MFX_ERR_INVALID_HANDLE A session of a task is not valid. \n
+   MFX_ERR_UNSUPPORTED Sessions of the tasks use different devices.
+*/
+mfxStatus MFX_CDECL MFXVideoENCODE_EncodeFrameBatchAsync(mfxEncodeFrameTask *tasks, mfxU32 num_tasks, mfxSyncPoint *syncp);
+#endif
+
 /*!
    @brief
      This function works in one of two modes:
@@ -560,6 +764,7 @@ mfxStatus MFX_CDECL MFXVideoDECODE_GetVideoParam(mfxSession session, mfxVideoPar
 /*!
    @brief
     This function obtains statistics collected during decoding.
+    Attach the mfxExtPerformanceStat buffer to the mfxDecodeStat structure to obtain performance statistics.
 
    @param[in] session SDK session handle.
    @param[in] stat  Pointer to the mfxDecodeStat structure
@@ -648,6 +853,44 @@ mfxStatus MFX_CDECL MFXVideoDECODE_GetPayload(mfxSession session, mfxU64 *ts, mf
    MFX_ERR_REALLOC_SURFACE  Bigger surface_work required. May be returned only if mfxInfoMFX::EnableReallocRequest was set to ON during initialization.
 */
 mfxStatus MFX_CDECL MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs, mfxFrameSurface1 *surface_work, mfxFrameSurface1 **surface_out, mfxSyncPoint *syncp);
+
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+/*! The mfxDecodeFrameTask structure describes one task of the batched decoding submission. The fields Session, Bs, SurfaceWork
+    and SurfaceOut have the same meaning as the corresponding arguments of MFXVideoDECODE_DecodeFrameAsync. */
+typedef struct {
+    mfxSession          Session;     /*!< SDK session handle. The decoder of the session must be initialized. */
+    mfxBitstream*       Bs;          /*!< Pointer to the input bitstream. */
+    mfxFrameSurface1*   SurfaceWork; /*!< Pointer to the working frame surface or NULL for internal allocation. */
+    mfxFrameSurface1*   SurfaceOut;  /*!< Output. Pointer to the output frame surface. Valid only if Status is MFX_ERR_NONE. */
+    mfxSyncPoint        SyncPoint;   /*!< Output. Sync point of the task. Valid only if Status is MFX_ERR_NONE. */
+    mfxStatus           Status;      /*!< Output. Status the task would get from MFXVideoDECODE_DecodeFrameAsync. */
+    mfxU32              reserved[3];
+} mfxDecodeFrameTask;
+MFX_PACK_END()
+
+/*!
+   @brief
+    This function submits several decoding tasks at once. The tasks may belong to one or several sessions; all sessions must
+    use the same device. Each task is processed as if MFXVideoDECODE_DecodeFrameAsync was called with its arguments, in the
+    order of the tasks array, but the per-call submission overhead is paid once for the whole batch. Tasks of the same session
+    are processed in the order they appear in the array.
+    The function returns an aggregated sync point which is signaled when all tasks with Status equal to MFX_ERR_NONE are
+    completed. The application can wait for it with MFXVideoCORE_SyncOperation using any session of the batch.
+    The tasks array can be reused by the application right after the function returns.
+
+   @param[in,out] tasks Pointer to the array of mfxDecodeFrameTask structures.
+   @param[in] num_tasks Number of elements in tasks.
+   @param[out] syncp Pointer to the aggregated sync point. Set to NULL if no task was submitted.
+
+   @return
+   MFX_ERR_NONE The function completed successfully; the status of each task is returned in its Status field. \n
+   MFX_ERR_NULL_PTR tasks or syncp is NULL. \n
+   MFX_ERR_INVALID_HANDLE A session of a task is not valid. \n
+   MFX_ERR_UNSUPPORTED Sessions of the tasks use different devices.
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_DecodeFrameBatchAsync(mfxDecodeFrameTask *tasks, mfxU32 num_tasks, mfxSyncPoint *syncp);
+#endif
  
 /* VideoVPP */
 
@@ -762,6 +1005,7 @@ mfxStatus MFX_CDECL MFXVideoVPP_GetVideoParam(mfxSession session, mfxVideoParam
 /*!
    @brief
     This function obtains statistics collected during video processing.
+    Attach the mfxExtPerformanceStat buffer to the mfxVPPStat structure to obtain performance statistics.
 
    @param[in] session SDK session handle.
    @param[in] stat  Pointer to the mfxVPPStat structure
@@ -794,6 +1038,140 @@ mfxStatus MFX_CDECL MFXVideoVPP_GetVPPStat(mfxSession session, mfxVPPStat *stat)
 */
 mfxStatus MFX_CDECL MFXVideoVPP_RunFrameVPPAsync(mfxSession session, mfxFrameSurface1 *in, mfxFrameSurface1 *out, mfxExtVppAuxData *aux, mfxSyncPoint *syncp);
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/* VideoDECODE_VPP */
+
+/*!
+   @brief
+    This function initializes the fused decode and video processing pipeline. Each decoded frame is read once and processed
+    into all output channels in a single pass over the device. The output surfaces of all channels are allocated internally,
+    so the application does not need to call MFXVideoDECODE_QueryIOSurf or MFXVideoVPP_QueryIOSurf for them.
+    The pipeline must be closed with MFXVideoDECODE_VPP_Close.
+
+   @param[in] session SDK session handle.
+   @param[in] decode_par Pointer to the mfxVideoParam structure which contains initialization parameters for the decoder.
+   @param[in] vpp_par_array Array of pointers to the mfxVideoChannelParam structures. Each structure describes one output channel.
+   @param[in] num_vpp_par Number of elements in vpp_par_array.
+
+   @return
+   MFX_ERR_NONE  The function completed successfully. \n
+   MFX_ERR_NULL_PTR  decode_par or vpp_par_array is NULL while num_vpp_par is not zero. \n
+   MFX_ERR_INVALID_VIDEO_PARAM  The function detected invalid video parameters, for example duplicated channel IDs. \n
+   MFX_WRN_PARTIAL_ACCELERATION  The underlying hardware does not fully support the specified video parameters.
+                                 The video processing may be partially accelerated. Only SDK HW implementations may return this status code. \n
+   MFX_WRN_INCOMPATIBLE_VIDEO_PARAM  The function detected some video parameters were incompatible with others; incompatibility resolved. \n
+   MFX_ERR_UNDEFINED_BEHAVIOR  The function is called twice without a close.
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_VPP_Init(mfxSession session, mfxVideoParam* decode_par, mfxVideoChannelParam** vpp_par_array, mfxU32 num_vpp_par);
+
+/*!
+   @brief
+    This function stops the current fused decode and video processing operation and restores internal structures or parameters
+    for a new operation. Channels can be reconfigured, but channels cannot be added or removed.
+
+   @param[in] session SDK session handle.
+   @param[in] decode_par Pointer to the mfxVideoParam structure which contains new parameters for the decoder.
+   @param[in] vpp_par_array Array of pointers to the mfxVideoChannelParam structures with new parameters of the channels.
+   @param[in] num_vpp_par Number of elements in vpp_par_array.
+
+   @return
+   MFX_ERR_NONE  The function completed successfully. \n
+   MFX_ERR_INVALID_VIDEO_PARAM  The function detected that video parameters are wrong or they conflict with initialization parameters. Reset is impossible. \n
+   MFX_ERR_INCOMPATIBLE_VIDEO_PARAM  The function detected that provided by the application video parameters are incompatible with initialization parameters.
+                                     Reset requires additional memory allocation and cannot be executed. \n
+   MFX_WRN_INCOMPATIBLE_VIDEO_PARAM  The function detected some video parameters were incompatible with others; incompatibility resolved.
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_VPP_Reset(mfxSession session, mfxVideoParam* decode_par, mfxVideoChannelParam** vpp_par_array, mfxU32 num_vpp_par);
+
+/*!
+   @brief
+    This function returns the current parameters of the channel with the given ID.
+
+   @param[in] session SDK session handle.
+   @param[out] par Pointer to the mfxVideoChannelParam structure allocated by the application.
+   @param[in] channel_id ID of the channel.
+
+   @return
+   MFX_ERR_NONE  The function completed successfully. \n
+   MFX_ERR_NULL_PTR  par is NULL. \n
+   MFX_ERR_NOT_FOUND  There is no channel with the given ID. \n
+   MFX_ERR_NOT_INITIALIZED  The pipeline was not initialized.
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_VPP_GetChannelParam(mfxSession session, mfxVideoChannelParam* par, mfxU32 channel_id);
+
+/*!
+   @brief
+    This function decodes the input bitstream and processes the decoded frame into all output channels which are not skipped.
+    The decoder output (channel ID 0) is returned as the first surface of the array. The returned array should be released with
+    mfxSurfaceArray::Release after usage; a surface which the application needs to keep longer must be referenced with
+    mfxFrameSurfaceInterface::AddRef before the array is released.
+    This function is asynchronous. Surfaces of the array are synchronized with mfxFrameSurfaceInterface::Synchronize.
+    At the end of the stream, call this function with the input argument bs=NULL to retrieve any remaining frames, until the
+    function returns MFX_ERR_MORE_DATA.
+
+   @param[in] session SDK session handle.
+   @param[in] bs Pointer to the input bitstream.
+   @param[in] skip_channels Pointer to the array of IDs of channels which should not produce output for this frame. Can be NULL.
+   @param[in] num_skip_channels Number of elements in skip_channels.
+   @param[out] surf_array_out Pointer is set to the array of output surfaces.
+
+   @return
+   MFX_ERR_NONE The function completed successfully and the output surfaces are ready after synchronization. \n
+   MFX_ERR_MORE_DATA The function requires more bitstream at input before decoding can proceed. \n
+   MFX_ERR_NULL_PTR surf_array_out is NULL. \n
+   MFX_ERR_DEVICE_LOST  Hardware device was lost; See the Working with Microsoft* DirectX* Applications section for further information. \n
+   MFX_WRN_DEVICE_BUSY  Hardware device is currently busy. Call this function again in a few milliseconds. \n
+   MFX_WRN_VIDEO_PARAM_CHANGED  The decoder detected a new sequence header in the bitstream. Video parameters may have changed. \n
+   MFX_ERR_INCOMPATIBLE_VIDEO_PARAM  The decoder detected incompatible video parameters in the bitstream and failed to follow them.
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_VPP_DecodeFrameAsync(mfxSession session, mfxBitstream* bs, mfxU32* skip_channels, mfxU32 num_skip_channels, mfxSurfaceArray** surf_array_out);
+
+/*!
+   @brief
+    This function decodes a batch of still pictures and writes them at once into a tensor through a channel configured with
+    the mfxExtVPPTensorOutput structure. Each bitstream of the array must contain one complete picture. Picture n is resized,
+    color converted and normalized by the channel and written as picture n of the batch; other channels are skipped. The
+    pictures may have different sizes that do not exceed the size the pipeline was initialized with.
+    No surfaces are returned and no copy of the output is made: the tensor is written by the implementation directly. If
+    the output memory access type of the channel is MFX_IOPATTERN_OUT_SYSTEM_MEMORY, tensor points to system memory. If it is
+    MFX_IOPATTERN_OUT_VIDEO_MEMORY, tensor points to memory that the device of the session can write directly, for example
+    a unified shared memory allocation made for the same device. The tensor may be accessed by the application, or passed to
+    another library that uses the same device, after the returned sync point is synchronized.
+    This function is asynchronous. The tensor must stay valid until the sync point is synchronized.
+
+   @param[in] session SDK session handle.
+   @param[in] bs_array Pointer to the array of input bitstreams, one picture per bitstream.
+   @param[in] num_bs Number of elements in bs_array. Must not exceed mfxExtVPPTensorOutput::BatchSize.
+   @param[in] channel_id ID of the channel configured with the mfxExtVPPTensorOutput structure.
+   @param[out] tensor Pointer to the tensor memory, aligned to 64 bytes, of size num_bs * 3 * H * W elements.
+   @param[out] status_array Pointer to the array of num_bs elements which receives the status of each picture after the
+               sync point is synchronized. The content of the tensor for a picture whose status is not MFX_ERR_NONE is
+               undefined. Can be NULL.
+   @param[out] syncp Pointer to the sync point of the batch.
+
+   @return
+   MFX_ERR_NONE The function completed successfully. \n
+   MFX_ERR_NULL_PTR bs_array, tensor or syncp is NULL. \n
+   MFX_ERR_INVALID_VIDEO_PARAM channel_id does not identify a channel with tensor output, or num_bs exceeds the batch size. \n
+   MFX_ERR_UNSUPPORTED The decoder is not a still picture decoder, such as JPEG, or tensor is not accessible by the device. \n
+   MFX_ERR_DEVICE_LOST  Hardware device was lost; See the Working with Microsoft* DirectX* Applications section for further information. \n
+   MFX_WRN_DEVICE_BUSY  Hardware device is currently busy. Call this function again in a few milliseconds.
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_VPP_DecodeBatchToTensorAsync(mfxSession session, mfxBitstream** bs_array, mfxU32 num_bs, mfxU32 channel_id, void* tensor, mfxStatus* status_array, mfxSyncPoint* syncp);
+
+/*!
+   @brief
+    This function terminates the fused decode and video processing pipeline and de-allocates any internal tables or structures.
+    Output surfaces which are still referenced by the application stay valid until they are released.
+
+   @param[in] session SDK session handle.
+
+   @return MFX_ERR_NONE
+   The function completed successfully. \n
+*/
+mfxStatus MFX_CDECL MFXVideoDECODE_VPP_Close(mfxSession session);
+#endif
+
 #ifdef __cplusplus
 } // extern "C"
 #endif